@@ -0,0 +1,103 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    animationsystem.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Avancement groupé des animations des sprites.
+ */
+
+#ifndef ANIMATIONSYSTEM_HPP
+#define ANIMATIONSYSTEM_HPP
+
+#include <vector>
+#include <SDL2/SDL.h>
+#include <Cirion/point2.hpp>
+#include <Cirion/sprite.hpp>
+
+#define ANIMATIONS_GRAIN 1024 // Sprites par tâche du système de tâches
+
+namespace cirion
+{
+    /**
+     * @class AnimationSystem animationsystem.hpp
+     *
+     * Une classe pour stocker l'état d'animation de tous les sprites en
+     * tableaux parallèles (animation, image, temps écoulé, orientation) et
+     * les faire avancer d'un seul balayage par mise à jour. Les rectangles
+     * source sont écrits en bloc; les sprites les relisent au dessin.
+     *
+     * Les sprites sont désignés par une poignée stable: les tableaux restent
+     * compacts, un retrait déplaçant le dernier élément dans le trou.
+     */
+    class AnimationSystem
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        AnimationSystem();
+        ~AnimationSystem();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        int add( const SpriteData* data );
+        void remove( int handle );
+        void clear();
+        void update( float timeStep );
+        void setData( int handle, const SpriteData* data );
+        void setAnimation( int handle, int id );
+        void setFacingRight( int handle, bool facingRight );
+        int getAnimation( int handle );
+        bool isFacingRight( int handle );
+        const SDL_Rect& getSrc( int handle );
+        const Point2i& getOffset( int handle );
+        size_t getCount();
+        bool isAnimating();
+        static size_t getSlotSize();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        static void updateRange( void* data, size_t first, size_t last );
+        void advance( size_t first, size_t last );
+        void writeFrame( size_t i );
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        float mTimeStep;                       //!< Temps de la mise à jour
+        std::vector<const SpriteData*> mData;  //!< Données des sprites
+        std::vector<int> mAnimationIds;        //!< Animations en cours
+        std::vector<Uint32> mFrameIndices;     //!< Images en cours
+        std::vector<float> mElapsed;           //!< Temps écoulés, en ms
+        std::vector<Uint8> mFacingRight;       //!< Orientations
+        std::vector<SDL_Rect> mSrcs;           //!< Rectangles source
+        std::vector<Point2i> mOffsets;         //!< Décalages des rognages
+        std::vector<int> mHandles;             //!< Indice -> poignée
+        std::vector<int> mIndices;             //!< Poignée -> indice
+        std::vector<int> mFreeHandles;         //!< Poignées libres
+    };
+}
+
+#endif // ANIMATIONSYSTEM_HPP
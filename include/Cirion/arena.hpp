@@ -0,0 +1,86 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    arena.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Allocation linéaire des données d'un niveau.
+ */
+
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <vector>
+#include <SDL2/SDL.h>
+
+#define ARENA_CHUNK_SIZE 65536 // Taille par défaut des blocs, en octets
+
+namespace cirion
+{
+    /**
+     * @class Arena arena.hpp
+     *
+     * Une classe pour allouer les données d'un niveau par simple avancée
+     * d'un curseur dans de grands blocs. Rien n'est libéré à l'unité: reset()
+     * rend toute l'arène d'un coup, en O(1), et garde les blocs pour le
+     * niveau suivant. Seules des données sans déstructeur y ont leur place.
+     */
+    class Arena
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        Arena( size_t chunkSize = ARENA_CHUNK_SIZE );
+        ~Arena();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void* allocate( size_t size, size_t alignment );
+        void reset();
+        void clear();
+        size_t getUsedSize();
+        size_t getReservedSize();
+
+        //! @brief Fonction d'allocation d'un tableau non initialisé.
+        //! @param count Le nombre d'éléments.
+        //! @return Pointeur vers le premier élément.
+        template <typename Type> Type* allocate( size_t count )
+        {
+            return (Type*)allocate( count * sizeof(Type), __alignof__(Type) );
+        }
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        std::vector<Uint8*> mChunks;  //!< Blocs réservés
+        std::vector<size_t> mSizes;   //!< Taille de chaque bloc
+        size_t mChunkSize;            //!< Taille par défaut des blocs
+        size_t mChunk;                //!< Bloc en cours
+        size_t mOffset;               //!< Curseur dans le bloc en cours
+        size_t mUsedSize;             //!< Octets alloués depuis reset()
+    };
+}
+
+#endif // ARENA_HPP
@@ -0,0 +1,150 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file    assetwatcher.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Rechargement à chaud des ressources.
+ */
+
+#ifndef ASSETWATCHER_HPP
+#define ASSETWATCHER_HPP
+
+#include <string>
+#include <vector>
+#include <SDL2/SDL.h>
+#include <Cirion/cookedtexture.hpp>
+
+#define ASSETWATCHER_UPLOAD_ROWS 16 // Rangées de pixels envoyées par étape
+
+namespace cirion
+{
+    class Texture;
+
+    /**
+     * Les types de ressources surveillées.
+     */
+    typedef enum
+    {
+        ASSET_TEXTURE,
+        ASSET_CMF,
+        ASSET_ENTITY
+    } AssetType;
+
+    /**
+     * Une structure pour représenter une ressource à recharger.
+     */
+    typedef struct
+    {
+        AssetType type;
+        std::string name;
+    } PendingAsset;
+
+    /**
+     * Les états du fil de chargement des textures.
+     */
+    typedef enum
+    {
+        LOADER_IDLE,    // En attente d'une texture
+        LOADER_BUSY,    // Lecture et cuisson en cours
+        LOADER_DONE     // Pixels prêts à être envoyés
+    } LoaderState;
+
+    /**
+     * Une structure pour représenter une texture en cours d'envoi.
+     */
+    typedef struct
+    {
+        Texture* texture;
+        Uint32 sourceHash; // Empreinte de la texture au début de l'envoi
+        SDL_Rect rect;     // Les pixels à envoyer
+    } TextureUpload;
+
+    /**
+     * @class AssetWatcher assetwatcher.hpp
+     *
+     * Une classe pour surveiller le répertoire des ressources (inotify) et
+     * recharger les textures, CMFs et entités modifiées entre deux images.
+     *
+     * Le rechargement avance par étapes tant que le budget de l'image n'est
+     * pas épuisé, et d'au moins une étape par image. Une texture est lue,
+     * cuite et comparée au cache par un fil de chargement; le fil principal
+     * n'en envoie que le rectangle modifié, par bandes de
+     * ASSETWATCHER_UPLOAD_ROWS rangées. Un CMF ou une entité est rechargé
+     * en une seule étape.
+     */
+    class AssetWatcher
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        AssetWatcher();
+        ~AssetWatcher();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void start( const char* workingDir );
+        void stop();
+        void poll( int budget );
+        size_t getPendingCount();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        static int loadTextures( void* data );
+        void readEvents();
+        void queue( AssetType type, const std::string& name );
+        bool step();
+        void reload( const PendingAsset& asset );
+        void prepareTexture();
+        void beginUpload();
+        void uploadBand();
+        void endUpload();
+        void findTextures( std::vector<Texture*>& textures );
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        int mFd;                            //!< Descripteur inotify
+        int mTexturesWatch;                 //!< Surveillance des textures
+        int mCmfsWatch;                     //!< Surveillance des CMFs
+        int mEntitiesWatch;                 //!< Surveillance des entités
+        std::vector<PendingAsset> mPending; //!< Ressources à recharger
+        SDL_Thread* mLoader;                //!< Le fil de chargement
+        SDL_sem* mLoaderWake;               //!< Réveil du fil de chargement
+        SDL_atomic_t mIsLoaderRunning;      //!< Fil de chargement actif
+        SDL_atomic_t mLoaderState;          //!< Voir LoaderState
+        std::string mLoadName;              //!< La texture à charger
+        CookedTexture mLoadCooked;          //!< Ses nouveaux pixels
+        Uint32 mLoadHash;                   //!< L'empreinte de son bitmap
+        Uint32 mLoadPreviousHash;           //!< Celle du cache relu, ou 0
+        SDL_Rect mLoadRect;                 //!< Pixels modifiés depuis le
+                                            //!< cache
+        bool mIsLoadCached;                 //!< Nouveau cache écrit à côté
+        std::vector<TextureUpload> mUploads; //!< Textures en cours d'envoi
+        int mUploadRow;                     //!< Prochaine rangée à envoyer
+        int mUploadEnd;                     //!< Après la dernière rangée
+    };
+}
+
+#endif // ASSETWATCHER_HPP
@@ -0,0 +1,49 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    bench.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Mesures de performance.
+ */
+
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+namespace cirion
+{
+    void benchLevelLoad( const char* name, int iterations );
+    void benchAnimations( int count, int ticks );
+    void benchCollisions( int count, int ticks );
+    void benchTiles( int count, int ticks );
+    void benchObjects( int count, int ticks );
+    void benchSpawn( int count, int ticks );
+    void benchParticles( int count, int ticks );
+    void benchJobs( int count, int ticks );
+    void benchPacing( int frames, int work );
+    void benchLog( int count );
+    void benchSimulation( const char* name, int entities, int particles,
+                          int ticks );
+}
+
+#endif // BENCH_HPP
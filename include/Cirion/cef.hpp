@@ -0,0 +1,151 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    cef.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Format d'entité compilé.
+ */
+
+#ifndef CEF_HPP
+#define CEF_HPP
+
+#include <vector>
+#include <tinyxml2.h>
+#include <SDL2/SDL.h>
+#include <Cirion/sprite.hpp>
+
+#define CEF_MAGIC   0x00464543 // "CEF\0"
+#define CEF_VERSION 2
+
+namespace cirion
+{
+    /**
+     * @struct CefHeader
+     *
+     * L'en-tête d'un fichier d'entité compilée.
+     */
+    typedef struct
+    {
+        Uint32 magic;
+        Uint32 version;
+        Sint64 sourceTime;  //!< Date de modification du XML compilé
+        Uint32 spriteCount;
+        Uint32 reserved;
+    } CefHeader;
+
+    /**
+     * Un sprite, tel qu'écrit dans le fichier; suivi de ses animations.
+     */
+    typedef struct
+    {
+        char name[16];
+        char spritesheet[16];
+        Sint32 srcW;
+        Sint32 srcH;
+        Sint32 hitbox[4];
+        Sint32 initialAnimation;
+        Uint32 animationCount;
+        Uint32 transitionCount;
+    } CefSprite;
+
+    /**
+     * Une animation, telle qu'écrite dans le fichier; suivie de ses images.
+     */
+    typedef struct
+    {
+        char name[16];
+        Uint32 frameCount;
+    } CefAnimation;
+
+    /**
+     * Une transition, telle qu'écrite dans le fichier; les transitions d'un
+     * sprite suivent ses animations.
+     */
+    typedef struct
+    {
+        Sint32 from;
+        Sint32 to;
+        Uint32 require;
+        Uint32 forbid;
+    } CefTransition;
+
+    /**
+     * Une image, telle qu'écrite dans le fichier.
+     */
+    typedef struct
+    {
+        Sint32 left[2];
+        Sint32 right[2];
+        Sint32 leftTrim[4];
+        Sint32 rightTrim[4];
+        Sint32 duration;
+    } CefFrame;
+
+    /**
+     * @class Cef cef.hpp
+     *
+     * Une classe pour manipuler le format d'entité compilé Cirion. Le XML
+     * reste le format d'édition: il est compilé dans le cache lorsqu'il est
+     * plus récent que sa version compilée.
+     */
+    class Cef
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        Cef();
+        ~Cef();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void load( const char* name );
+        void compile( const char* filepath );
+        void read( const char* filepath );
+        void write( const char* filepath );
+        void clear();
+        void swap( Cef& cef );
+        SpriteData* getSprite( const char* name );
+        std::vector<SpriteData>& getSprites();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        void compileSprite( tinyxml2::XMLElement* spriteNode, SpriteData* data );
+        static void compileTrim( tinyxml2::XMLElement* node,
+                                 const SpriteData* data,
+                                 SDL_Rect* trim );
+        static void copyName( char* name, const char* value, const char* what );
+        static int findAnimation( const SpriteData* data, const char* name );
+        static bool isValid( const SpriteData& data );
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        Sint64 mSourceTime;               //!< Date de modification du XML
+        std::vector<SpriteData> mSprites; //!< Les sprites de l'entité
+    };
+}
+
+#endif // CEF_HPP
@@ -30,8 +30,26 @@
 #define CIRION_HPP
 
 #include <vector>
+#include <Cirion/animationsystem.hpp>
+#include <Cirion/assetwatcher.hpp>
+#include <Cirion/collisionsystem.hpp>
 #include <Cirion/config.hpp>
+#include <Cirion/eventdispatcher.hpp>
+#include <Cirion/framepacer.hpp>
+#include <Cirion/framestats.hpp>
 #include <Cirion/gameobject.hpp>
+#include <Cirion/inputsystem.hpp>
+#include <Cirion/jobsystem.hpp>
+#include <Cirion/objectpool.hpp>
+#include <Cirion/overlay.hpp>
+#include <Cirion/particlesystem.hpp>
+#include <Cirion/pixelpool.hpp>
+#include <Cirion/profiler.hpp>
+#include <Cirion/prototype.hpp>
+#include <Cirion/registry.hpp>
+#include <Cirion/replay.hpp>
+#include <Cirion/statemachine.hpp>
+#include <Cirion/stats.hpp>
 #include <Cirion/texture.hpp>
 #include <Cirion/timer.hpp>
 #include <Cirion/world.hpp>
@@ -42,21 +60,71 @@ extern const int gRendererWidth;
 extern const int gRendererHeight;
 extern cirion::Config gConfig;
 extern bool gIsRunning;
-extern cirion::Timer gRenderTimer;
+extern bool gIsHeadless;
+extern Uint32 gFrame;
 extern SDL_Window* gWindow;
 extern SDL_Renderer* gRenderer;
 extern SDL_Event gEvent;
+extern SDL_Texture* gLastTexture;
 extern std::vector<cirion::Texture*> gTextures;
 extern std::vector<cirion::GameObject*> gGameObjects;
+extern std::vector<cirion::EntityPrototype*> gPrototypes;
 extern cirion::World gWorld;
+extern cirion::Stats gStats;
+extern cirion::FrameStats gFrameStats;
+extern cirion::FrameStats gUpdateStats;
+extern cirion::FrameStats gRenderStats;
+extern cirion::FrameStats gInputLatency;
+extern cirion::FrameStats* gSubsystemStats;
+extern cirion::AssetWatcher gAssetWatcher;
+extern cirion::AnimationSystem gAnimationSystem;
+extern cirion::CollisionSystem gCollisionSystem;
+extern cirion::EventDispatcher gEventDispatcher;
+extern cirion::FramePacer gFramePacer;
+extern cirion::InputSystem gInputSystem;
+extern cirion::JobSystem gJobSystem;
+extern cirion::PixelPool gPixelPool;
+extern cirion::Profiler gProfiler;
+extern cirion::Registry gRegistry;
+extern cirion::Replay gReplay;
+extern cirion::ObjectPool gSpritePool;
+extern cirion::ComponentPool<cirion::StateMachine> gStateMachines;
+extern cirion::ParticleSystem gParticleSystem;
+extern cirion::Overlay gOverlay;
 
 namespace cirion
 {
+    /**
+     * Les étapes de update(), mesurées séparément par simulate().
+     */
+    typedef enum
+    {
+        SUBSYSTEM_WORLD,
+        SUBSYSTEM_OBJECTS,
+        SUBSYSTEM_STATES,
+        SUBSYSTEM_ANIMATIONS,
+        SUBSYSTEM_REGISTRY,
+        SUBSYSTEM_COLLISIONS,
+        SUBSYSTEM_PARTICLES,
+        SUBSYSTEM_COUNT
+    } Subsystem;
+
     void init();
     void handleEvents();
-    void update( int timeStep = 0 );
-    void render();
+    void update( float timeStep = 0.0f );
+    void render( float alpha = 1.0f );
+    int renderCopy( SDL_Texture* texture,
+                    const SDL_Rect* src,
+                    const SDL_Rect* dest );
+    #if SDL_VERSION_ATLEAST( 2, 0, 18 )
+    int renderGeometry( SDL_Texture* texture,
+                        const SDL_Vertex* vertices, int vertexCount,
+                        const int* indices, int indexCount );
+    #endif
+    void trimTextures();
+    bool isIdle();
     void run();
+    void simulate( int ticks );
     void quit();
 }
 
@@ -0,0 +1,134 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    collisionsystem.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Détection groupée des collisions entre sprites.
+ */
+
+#ifndef COLLISIONSYSTEM_HPP
+#define COLLISIONSYSTEM_HPP
+
+#include <vector>
+#include <SDL2/SDL.h>
+#include <Cirion/point2.hpp>
+
+#define COLLISION_STRIP_HEIGHT 64 // Hauteur des bandes de balayage, en px
+
+namespace cirion
+{
+    class Sprite;
+
+    /**
+     * Une structure pour représenter un contact entre deux corps, désignés
+     * par leurs poignées.
+     */
+    typedef struct
+    {
+        int first;
+        int second;
+    } Contact;
+
+    /**
+     * Une structure pour ranger une boîte englobante en vue d'un test SIMD:
+     * (minX, minY, -maxX, -maxY). Deux boîtes a et b se recouvrent si les
+     * quatre composantes de b sont inférieures à (maxX, maxY, -minX, -minY)
+     * de a.
+     */
+    typedef struct
+    {
+        float v[4];
+    } CollisionBox;
+
+    /**
+     * @class CollisionSystem collisionsystem.hpp
+     *
+     * Une classe pour détecter les contacts entre les hitboxes de tous les
+     * corps, une fois par mise à jour.
+     *
+     * Phase large: balayage et élagage (sweep and prune) sur l'axe des
+     * abscisses, bande horizontale par bande horizontale. L'ordre de la mise
+     * à jour précédente est repris et retrié par insertion, les corps
+     * bougeant peu d'une image à l'autre; la répartition dans les bandes
+     * conserve cet ordre.
+     * Phase étroite: chaque boîte candidate est testée en une comparaison
+     * de quatre composantes (SSE2), ou composante par composante à défaut.
+     */
+    class CollisionSystem
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        CollisionSystem();
+        ~CollisionSystem();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        int add( Sprite* sprite, const SDL_Rect& hitbox );
+        void remove( int handle );
+        void clear();
+        void update();
+        void setHitbox( int handle, const SDL_Rect& hitbox );
+        void setPosition( int handle, const Point2f& position );
+        Sprite* getSprite( int handle );
+        const std::vector<Contact>& getContacts();
+        size_t getCount();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        void sort();
+        void buildStrips();
+        void sweep();
+        int getStrip( float y );
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        std::vector<Sprite*> mSprites;   //!< Sprites suivis, ou NULL
+        std::vector<SDL_Rect> mHitboxes; //!< Hitboxes relatives
+        std::vector<float> mMinX;        //!< Boîtes englobantes
+        std::vector<float> mMinY;
+        std::vector<float> mMaxX;
+        std::vector<float> mMaxY;
+        std::vector<int> mOrder;         //!< Indices triés selon mMinX
+        bool mIsOrderValid;              //!< Faux après un ajout / retrait
+        float mStripTop;                 //!< Ordonnée de la première bande
+        float mStripHeight;              //!< Hauteur des bandes
+        float mStripScale;               //!< Inverse de la hauteur
+        std::vector<int> mFirstStrips;   //!< Première bande de chaque corps
+        std::vector<int> mLastStrips;    //!< Dernière bande de chaque corps
+        std::vector<int> mStripStarts;   //!< Début de chaque bande
+        std::vector<int> mStripCursors;  //!< Curseurs de répartition
+        std::vector<int> mStripBodies;   //!< Corps, bande par bande
+        std::vector<CollisionBox> mStripBoxes; //!< Boîtes, bande par bande
+        std::vector<Contact> mContacts;  //!< Contacts de la mise à jour
+        std::vector<int> mHandles;       //!< Indice -> poignée
+        std::vector<int> mIndices;       //!< Poignée -> indice
+        std::vector<int> mFreeHandles;   //!< Poignées libres
+    };
+}
+
+#endif // COLLISIONSYSTEM_HPP
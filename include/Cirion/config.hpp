@@ -70,6 +70,18 @@ namespace cirion
         bool mIsFullscreen;
         bool mIsHwRenderEnabled;
         bool mIsVsyncEnabled;
+        bool mIsHotReloadEnabled;
+        int mHotReloadBudget;
+        int mTextureBudget;
+        bool mIsTextureCacheEnabled;
+        int mJobThreads;
+        int mSimulationRate;
+        int mMaxSimulationSteps;
+        int mTargetFps;
+        bool mIsIdleWaitEnabled;
+        int mIdleTimeout;
+        bool mIsOverlayVisible;
+        bool mIsLatencyMeasured;
         Keymap mKeyboardMap;
     };
 }
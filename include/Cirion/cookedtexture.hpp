@@ -0,0 +1,103 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file    cookedtexture.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Cache de textures précuites.
+ */
+
+#ifndef COOKEDTEXTURE_HPP
+#define COOKEDTEXTURE_HPP
+
+#include <SDL2/SDL.h>
+#include <Cirion/surface.hpp>
+
+#define CTX_MAGIC   0x00585443 // "CTX\0"
+#define CTX_VERSION 1
+
+namespace cirion
+{
+    /**
+     * @struct CtxHeader
+     *
+     * L'en-tête d'un fichier de texture précuite. Les pixels suivent
+     * immédiatement l'en-tête (32 octets, donc alignés).
+     */
+    typedef struct
+    {
+        Uint32 magic;
+        Uint32 version;
+        Uint32 sourceHash;
+        Uint32 format;
+        Sint32 width;
+        Sint32 height;
+        Sint32 pitch;
+        Uint32 reserved;
+    } CtxHeader;
+
+    /**
+     * @class CookedTexture cookedtexture.hpp
+     *
+     * Une classe pour manipuler les textures précuites: des pixels déjà
+     * convertis et dont la couleur clé est déjà appliquée, projetables en
+     * mémoire au lancement.
+     */
+    class CookedTexture
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        CookedTexture();
+        ~CookedTexture();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void load( const char* filepath );
+        void cook( Surface* surface, Uint32 sourceHash );
+        void write( const char* filepath );
+        void clear();
+        bool diff( CookedTexture& previous, SDL_Rect* rect );
+        Uint32 getSourceHash();
+        Uint32 getFormat();
+        int getWidth();
+        int getHeight();
+        int getPitch();
+        const void* getPixels();
+        static Uint32 computeSourceHash( const char* filepath );
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        CtxHeader mHeader;                //!< L'en-tête du fichier
+        const Uint8* mPixels;             //!< Pointeur vers les pixels
+        void* mMapping;                   //!< Projection mémoire du fichier
+        size_t mMappingSize;              //!< Taille de la projection
+        Uint8* mBuffer;                   //!< Image du fichier en mémoire,
+                                          //!< empruntée à la réserve
+        size_t mBufferSize;               //!< Taille de l'image en mémoire
+    };
+}
+
+#endif // COOKEDTEXTURE_HPP
@@ -29,9 +29,11 @@
 #ifndef ENTITY_HPP
 #define ENTITY_HPP
 
-#include <tinyxml2.h>
+#include <string>
+#include <vector>
 #include <Cirion/gameobject.hpp>
 #include <Cirion/point2.hpp>
+#include <Cirion/prototype.hpp>
 #include <Cirion/sprite.hpp>
 
 namespace cirion
@@ -42,14 +44,24 @@ namespace cirion
         Entity();
         virtual ~Entity();
         void load( const char* entityName );
+        const char* findMissingSprite( Cef& cef );
+        void reload();
+        void addSprite( Sprite* sprite );
         void draw( const Point2f& origin = Point2f( 0.0f, 0.0f ) );
-        tinyxml2::XMLElement* getSpriteNode( const char* spriteName );
+        const char* getName();
+        EntityPrototype* getPrototype();
+        virtual size_t getInstanceSize();
+        SpriteData* getSpriteData( const char* spriteName );
+        void setStateFlag( Uint32 flag, bool value );
+        Uint32 getStateFlags();
 
         protected:
-        /** Le document XML de l'entité */
-        tinyxml2::XMLDocument mXml;
+        /** Le prototype partagé de l'entité */
+        EntityPrototype* mPrototype;
         /** Le vecteur de sprites qui composent l'entité */
         std::vector<Sprite*> mSprites;
+        /** Les drapeaux d'état lus par la machine à états des sprites */
+        Uint32 mStateFlags;
     };
 }
 
@@ -0,0 +1,98 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    eventdispatcher.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Distribution des évenements aux objets abonnés.
+ */
+
+#ifndef EVENTDISPATCHER_HPP
+#define EVENTDISPATCHER_HPP
+
+#include <map>
+#include <vector>
+#include <SDL2/SDL.h>
+#include <Cirion/inputsystem.hpp>
+
+#define DISPATCHER_ACTION   0x00010000  // Clés des actions, après les types SDL
+
+namespace cirion
+{
+    class GameObject;
+
+    /**
+     * @class EventDispatcher eventdispatcher.hpp
+     *
+     * Une classe pour distribuer les évenements SDL aux seuls objets qui s'y
+     * sont abonnés, type par type: le coût d'un évenement ne dépend plus du
+     * nombre d'objets, mais du nombre d'intéressés.
+     *
+     * Les actions de gInputSystem passent par la même table, abonnées par
+     * identifiant d'action: leurs fronts sont distribués à l'échantillonnage,
+     * juste avant chaque pas, et donc rejoués à l'identique.
+     *
+     * Un objet peut s'abonner ou se désabonner pendant une distribution;
+     * les désabonnés ne reçoivent plus rien, les nouveaux abonnés attendent
+     * l'évenement suivant.
+     */
+    class EventDispatcher
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        EventDispatcher();
+        ~EventDispatcher();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void subscribe( Uint32 type, GameObject* object );
+        void unsubscribe( Uint32 type, GameObject* object );
+        void unsubscribe( GameObject* object );
+        void subscribeAction( Action action, GameObject* object );
+        void unsubscribeAction( Action action, GameObject* object );
+        void dispatch( SDL_Event* event );
+        void dispatchAction( Action action, bool isPressed );
+        void clear();
+        size_t getListenerCount( Uint32 type );
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        void deliver( Uint32 key, SDL_Event* event, Action action,
+                      bool isPressed );
+        void compact();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        typedef std::map<Uint32, std::vector<GameObject*> > ListenerMap;
+
+        ListenerMap mListeners;     //!< Abonnés, par type ou action
+        int mDepth;                 //!< Distributions en cours
+        bool mIsDirty;              //!< Désabonnements à compacter
+    };
+}
+
+#endif // EVENTDISPATCHER_HPP
@@ -0,0 +1,92 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    framepacer.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Cadence des images.
+ */
+
+#ifndef FRAMEPACER_HPP
+#define FRAMEPACER_HPP
+
+#include <SDL2/SDL.h>
+
+#define FRAMEPACER_OVERSHOOT 2 // Dépassement de sommeil supposé au départ, en ms
+
+namespace cirion
+{
+    /**
+     * @class FramePacer framepacer.hpp
+     *
+     * Une classe pour cadencer la boucle principale sans occuper un coeur:
+     * l'attente d'une image est d'abord dormie, par tranches de ms, puis
+     * achevée en attente active sur le compteur haute résolution. La part
+     * active est calibrée sur le dépassement mesuré des sommeils.
+     *
+     * Quand rien n'anime, l'attente se fait sur la file d'évenements: la
+     * boucle ne tourne plus qu'au rythme des entrées.
+     */
+    class FramePacer
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        FramePacer();
+        ~FramePacer();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void setTargetRate( int rate );
+        void setIdleTimeout( int timeout );
+        bool wait( bool idle );
+        int getTargetRate();
+        Uint64 getOvershoot();
+        Uint64 getSleepTime();
+        Uint64 getSpinTime();
+        Uint64 getElapsedTime();
+        unsigned int getIdleCount();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        void sleep();
+        void spin();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        int mRate;                  //!< Images par seconde visées, 0 sinon
+        int mIdleTimeout;           //!< Attente maximale d'évenements, en ms
+        Uint64 mPeriod;             //!< Durée d'une image, en battements
+        Uint64 mDeadline;           //!< Fin de l'image en cours
+        Uint64 mOvershoot;          //!< Dépassement estimé des sommeils
+        Uint64 mStartCounter;       //!< Compteur à la première attente
+        Uint64 mSleepCounter;       //!< Battements dormis ou attendus
+        Uint64 mSpinCounter;        //!< Battements d'attente active
+        unsigned int mIdleCount;    //!< Nombre d'attentes d'évenements
+    };
+}
+
+#endif // FRAMEPACER_HPP
@@ -0,0 +1,140 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    framestats.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Statistiques des durées d'images.
+ */
+
+#ifndef FRAMESTATS_HPP
+#define FRAMESTATS_HPP
+
+#include <string>
+#include <vector>
+#include <SDL2/SDL.h>
+
+#define HISTOGRAM_SUB_BITS 6    // Précision relative des seaux: 2^-5, ~3 %
+#define HISTOGRAM_MAGNITUDES 40 // Puissances de 2 couvertes, en ns (~18 min)
+#define FRAMESTATS_WINDOW 600   // Nombre de durées de la fenêtre glissante
+
+// Nombre de seaux: valeurs exactes sous 2^SUB_BITS, puis 2^(SUB_BITS-1) par
+// puissance de 2.
+#define HISTOGRAM_BUCKETS ( ( 1 << HISTOGRAM_SUB_BITS ) \
+    + ( HISTOGRAM_MAGNITUDES - HISTOGRAM_SUB_BITS ) * ( 1 << ( HISTOGRAM_SUB_BITS - 1 ) ) )
+
+namespace cirion
+{
+    /**
+     * Une structure pour résumer une série de durées, en ns.
+     */
+    typedef struct
+    {
+        Uint64 count;
+        Uint64 min;
+        Uint64 avg;
+        Uint64 p50;
+        Uint64 p95;
+        Uint64 p99;
+        Uint64 max;
+    } FrameSummary;
+
+    /**
+     * @class Histogram framestats.hpp
+     *
+     * Une classe pour compter des durées dans des seaux log-linéaires, à la
+     * façon de HdrHistogram: chaque puissance de 2 est découpée en seaux de
+     * même largeur, ce qui borne l'erreur relative quelle que soit la durée.
+     */
+    class Histogram
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        Histogram();
+        ~Histogram();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void add( Uint64 value );
+        void remove( Uint64 value );
+        void clear();
+        Uint64 getPercentile( double percentile );
+        Uint64 getCount();
+        Uint64 getCount( Uint64 from, Uint64 to );
+        static size_t getIndex( Uint64 value );
+        static Uint64 getLowerBound( size_t index );
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        std::vector<Uint32> mBuckets; //!< Nombre de durées par seau
+        Uint64 mCount;                //!< Nombre total de durées
+    };
+
+    /**
+     * @class FrameStats framestats.hpp
+     *
+     * Une classe pour collecter des durées (images, mises à jour, rendus):
+     * une fenêtre glissante des dernières durées, interrogeable en cours de
+     * jeu, et un histogramme de toute la session reporté à la sortie.
+     */
+    class FrameStats
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        FrameStats( size_t window = FRAMESTATS_WINDOW );
+        ~FrameStats();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void add( Uint64 duration );
+        void clear();
+        Uint64 getRecent( size_t age );
+        size_t getWindowCount();
+        FrameSummary getWindowSummary();
+        FrameSummary getTotalSummary();
+        std::string getReport( const char* name, bool histogram );
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        std::vector<Uint64> mWindow; //!< Dernières durées, en anneau
+        size_t mWindowNext;          //!< Prochaine case de l'anneau
+        size_t mWindowCount;         //!< Nombre de cases remplies
+        Histogram mWindowHistogram;  //!< Histogramme de la fenêtre
+        Histogram mTotalHistogram;   //!< Histogramme de la session
+        Uint64 mTotalMin;            //!< Durée minimale de la session
+        Uint64 mTotalMax;            //!< Durée maximale de la session
+        Uint64 mTotalSum;            //!< Somme des durées de la session
+    };
+
+    void logFrameStats();
+}
+
+#endif // FRAMESTATS_HPP
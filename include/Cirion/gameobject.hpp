@@ -30,15 +30,19 @@
 #define GAMEOBJECT_HPP
 
 #include <SDL2/SDL.h>
-#include <Cirion/texture.hpp>
+#include <Cirion/inputsystem.hpp>
 #include <Cirion/point2.hpp>
+#include <Cirion/registry.hpp>
+#include <Cirion/texture.hpp>
 
 namespace cirion
 {
     /**
      * @class Object object.hpp
      *
-     * Une classe abstraîte pour manipuler des objets.
+     * Une classe abstraîte pour manipuler des objets. Les données de l'objet
+     * (position, vitesse, image) sont des composants de gRegistry, parcourus
+     * en bloc par ses systèmes: l'objet n'en garde que l'identifiant.
      */
     class GameObject
     {
@@ -46,24 +50,26 @@ namespace cirion
         GameObject();
         virtual ~GameObject();
         virtual void handleEvent( SDL_Event* event = NULL ) = 0;
-        virtual void update( int timeStep = 0 ) = 0;
+        virtual void handleAction( Action action, bool isPressed );
+        virtual void update( float timeStep = 0.0f ) = 0;
+        virtual bool isActive();
         virtual void draw( const Point2f& origin = Point2f( 0, 0 ) );
         void setTexture( const char* name );
         void setSrc( int x, int y, int w, int h );
         void setPosition( const Point2f& position );
+        void warp( const Point2f& position );
+        void setVelocity( const Point2f& velocity );
+        ObjectId getId();
         SDL_Rect getSrc();
         SDL_Rect getDest();
         Point2f getPosition();
+        Point2f getVelocity();
 
         protected:
-        /** La position de l'objet */
-        Point2f mPosition;
-        /** Pointeur vers la texture de l'objet */
-        Texture* mTexture;
-        /** Le repère source, pour l'affichage */
-        SDL_Rect mSrc;
-        /** Le repère de destination, pour l'affichage */
-        SDL_Rect mDest;
+        Renderable& getRenderable();
+
+        /** L'identifiant de l'objet dans gRegistry */
+        ObjectId mId;
     };
 }
 
@@ -45,7 +45,7 @@ namespace cirion
            ! Déclaration des méthodes publiques.                            !
            +----------------------------------------------------------------+ */
         void handleEvent( SDL_Event* event = NULL );
-        void update( int timeStep = 0 );
+        void update( float timeStep = 0.0f );
     };
 }
 
@@ -35,6 +35,9 @@
 
 #define HIRO_XVELOCITY_MAX  0.1f       // Pixels / ms
 #define HIRO_XVELOCITY_STEP 0.0005f   // Pixels / ms
+#define HIRO_YVELOCITY_MAX  0.4f      // Pixels / ms
+#define HIRO_GRAVITY        0.0008f   // Pixels / ms²
+#define HIRO_JUMP_VELOCITY  0.3f      // Pixels / ms
 
 namespace cirion
 {
@@ -51,7 +54,10 @@ namespace cirion
            +----------------------------------------------------------------+ */
         void create( const char* entityName );
         void handleEvent( SDL_Event* event = NULL );
-        void update( int timeStep = 0 );
+        void handleAction( Action action, bool isPressed );
+        void update( float timeStep = 0.0f );
+        bool isActive();
+        size_t getInstanceSize();
 
         private:
         /* +----------------------------------------------------------------+
@@ -59,10 +65,9 @@ namespace cirion
            +----------------------------------------------------------------+ */
         float mXVelocity;
         float mYVelocity;
-        bool mInputLeft;
-        bool mInputRight;
         bool mStatusGoLeft;
         bool mStatusGoRight;
+        bool mIsGrounded;
         Sprite* mMainSprite;
     };
 }
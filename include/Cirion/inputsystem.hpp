@@ -0,0 +1,110 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    inputsystem.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Échantillonnage des entrées en actions.
+ */
+
+#ifndef INPUTSYSTEM_HPP
+#define INPUTSYSTEM_HPP
+
+#include <SDL2/SDL.h>
+#include <Cirion/config.hpp>
+
+namespace cirion
+{
+    /**
+     * Les actions du joueur, dans l'ordre de la Keymap. Chacune occupe un
+     * bit de l'état échantillonné.
+     */
+    typedef enum
+    {
+        ACTION_UP,
+        ACTION_DOWN,
+        ACTION_LEFT,
+        ACTION_RIGHT,
+        ACTION_JUMP,
+        ACTION_FIRE,
+        ACTION_COUNT
+    } Action;
+
+    /**
+     * @class InputSystem inputsystem.hpp
+     *
+     * Une classe pour traduire le clavier en actions, d'après la Keymap de
+     * la configuration. Les évenements tiennent un état vivant; sample() le
+     * fige juste avant chaque pas de simulation, qui lit alors un état
+     * stable, ses fronts (enfoncée / relachée depuis le pas précédent) et
+     * l'horodatage des appuis. Les fronts sont aussi distribués aux
+     * abonnés de gEventDispatcher.
+     *
+     * Un appui plus court qu'un pas est retenu jusqu'à l'échantillon
+     * suivant: il dure alors un pas au lieu de se perdre.
+     */
+    class InputSystem
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        InputSystem();
+        ~InputSystem();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void setKeymap( const Keymap& keymap );
+        void setLatencyMeasured( bool isMeasured );
+        void handleEvent( SDL_Event* event );
+        void sample();
+        void present();
+        void clear();
+        bool isDown( Action action );
+        bool isPressed( Action action );
+        bool isReleased( Action action );
+        Uint32 getState();
+        Uint32 getPressTime( Action action );
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        int getAction( SDL_Keycode key );
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        SDL_Keycode mKeys[ACTION_COUNT];    //!< Touche de chaque action
+        Uint32 mLive;                       //!< Actions tenues, d'après les évenements
+        Uint32 mLatched;                    //!< Appuis depuis le dernier échantillon
+        Uint32 mState;                      //!< Actions au dernier échantillon
+        Uint32 mPrevious;                   //!< Actions à l'échantillon précédent
+        Uint32 mLiveTime[ACTION_COUNT];     //!< Dernier appui vu, en ms SDL
+        Uint32 mPressTime[ACTION_COUNT];    //!< Appui échantillonné, en ms SDL
+        Uint32 mPendingTime;                //!< Plus ancien appui non présenté
+        bool mIsPending;                    //!< Un appui attend sa présentation
+        bool mIsLatencyMeasured;            //!< Mesure entrée -> présentation
+    };
+}
+
+#endif // INPUTSYSTEM_HPP
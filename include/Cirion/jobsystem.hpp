@@ -0,0 +1,131 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    jobsystem.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Répartition des mises à jour sur les coeurs.
+ */
+
+#ifndef JOBSYSTEM_HPP
+#define JOBSYSTEM_HPP
+
+#include <vector>
+#include <SDL2/SDL.h>
+
+#define JOBSYSTEM_MAX_THREADS 64 // Nombre maximum de fils, principal compris
+#define JOBQUEUE_CAPACITY 256    // Nombre de tâches par file
+
+namespace cirion
+{
+    class JobSystem;
+
+    /**
+     * Une fonction de traîtement d'un intervalle [first, last[ d'éléments.
+     */
+    typedef void (*JobFunction)( void* data, size_t first, size_t last );
+
+    /**
+     * Une structure pour représenter une tâche: un intervalle d'éléments.
+     */
+    typedef struct
+    {
+        JobFunction function;
+        void* data;
+        size_t first;
+        size_t last;
+    } Job;
+
+    /**
+     * Une structure pour représenter la file de tâches d'un fil. Son fil la
+     * vide par la fin, les autres volent par le début.
+     */
+    typedef struct
+    {
+        Job jobs[JOBQUEUE_CAPACITY];
+        size_t top;        // Prochaine tâche à voler
+        size_t bottom;     // Après la dernière tâche
+        SDL_SpinLock lock;
+    } JobQueue;
+
+    /**
+     * Une structure pour représenter un fil de travail.
+     */
+    typedef struct
+    {
+        JobSystem* system;
+        SDL_Thread* thread;
+        int index;
+    } JobWorker;
+
+    /**
+     * @class JobSystem jobsystem.hpp
+     *
+     * Une classe pour répartir un traîtement par intervalles sur un fil par
+     * coeur, le fil principal compris. Les intervalles sont distribués en
+     * blocs contigus dans les files des fils; un fil sans travail vole celui
+     * des autres.
+     *
+     * Une tâche n'écrit que dans les éléments de son intervalle: le résultat
+     * ne dépend ni du nombre de fils, ni de l'ordre d'exécution. Les effets
+     * qui doivent être ordonnés (créations, évenements) restent au fil
+     * principal, après parallelFor().
+     */
+    class JobSystem
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        JobSystem();
+        ~JobSystem();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void start( int threadCount = 0 );
+        void stop();
+        void parallelFor( size_t count, size_t grain,
+                          JobFunction function, void* data );
+        int getThreadCount();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        static int work( void* data );
+        void push( int index, const Job& job );
+        bool pop( int index, Job& job );
+        bool steal( int index, Job& job );
+        void runPending( int index );
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        std::vector<JobQueue*> mQueues;   //!< Une file par fil, 0: principal
+        std::vector<JobWorker*> mWorkers; //!< Les fils de travail
+        SDL_sem* mWake;                   //!< Réveil des fils de travail
+        SDL_atomic_t mPending;            //!< Tâches restantes
+        SDL_atomic_t mIsRunning;          //!< Indique l'activité des fils
+    };
+}
+
+#endif // JOBSYSTEM_HPP
@@ -35,6 +35,9 @@ namespace cirion
 {
     void log( const char* msg, const char* from );
     void log( const CiException& e );
+    void startLogging();
+    void stopLogging();
+    unsigned int getDroppedLogCount();
 }
 
 #endif // LOG_HPP
@@ -0,0 +1,113 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    logger.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Écriture différée du journal.
+ */
+
+#ifndef LOGGER_HPP
+#define LOGGER_HPP
+
+#include <ostream>
+#include <SDL2/SDL.h>
+
+#define LOGGER_SLOTS      1024 // Cases de l'anneau, puissance de 2
+#define LOGGER_SLOT_SIZE  64   // Octets par case
+#define LOGGER_MAX_RECORD 8192 // Taille maximale d'un message formaté
+#define LOGGER_TIMEOUT    1000 // Attente maximale du fil d'écriture, en ms
+
+namespace cirion
+{
+    /**
+     * @class Logger logger.hpp
+     *
+     * Une classe pour écrire le journal depuis un fil dédié. Les appelants,
+     * de n'importe quel fil, réservent des cases contiguës d'un anneau borné
+     * (une comparaison-échange) et y copient leur message déjà formaté; le
+     * fil d'écriture vide l'anneau dans le flux, avec un seul vidage par
+     * lot de messages.
+     *
+     * Chaque case porte un numéro de séquence, comme la file bornée de
+     * D. Vyukov: l'appelant la sait libre, l'écrivain la sait publiée. Un
+     * anneau plein ne bloque pas l'appelant: le message est abandonné et
+     * compté.
+     *
+     * Sur signal fatal, les messages publiés sont écrits par le fil fautif
+     * avant l'arrêt, au mieux: par write() sur un descripteur ouvert au
+     * démarrage, sans flux ni allocation.
+     *
+     * Pendant l'arrêt, les messages des appelants sont abandonnés et
+     * comptés; ceux déjà engagés sont publiés avant le dernier vidage.
+     */
+    class Logger
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        Logger( std::ostream& stream );
+        ~Logger();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void start( const char* crashPath = NULL );
+        void stop();
+        bool push( const char* const* parts, int partCount );
+        void flush();
+        bool isRunning();
+        Uint32 getDroppedCount();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        static int write( void* data );
+        static void flushOnCrash( int signal );
+        void drain( bool isCrashing = false );
+        bool publish( const char* const* parts, int partCount );
+        bool isEmpty();
+        size_t copyIn( size_t offset, const char* source, size_t size );
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        std::ostream& mStream;                  //!< Le flux du journal
+        char* mRing;                            //!< Octets des messages
+        SDL_atomic_t mSequences[LOGGER_SLOTS];  //!< Séquence de chaque case
+        SDL_atomic_t mHead;                     //!< Prochaine case à réserver
+        Uint32 mTail;                           //!< Prochaine case à écrire
+        SDL_atomic_t mDropped;                  //!< Messages abandonnés
+        Uint32 mReportedDrops;                  //!< Abandons déjà signalés
+        SDL_atomic_t mIsRunning;                //!< Fil d'écriture actif
+        SDL_atomic_t mIsSleeping;               //!< Fil d'écriture endormi
+        SDL_atomic_t mIsStopping;               //!< Arrêt en cours
+        SDL_atomic_t mPushers;                  //!< Appelants dans push()
+        int mCrashFd;                           //!< Descripteur sur signal fatal
+        SDL_SpinLock mDrainLock;                //!< Un seul écrivain à la fois
+        SDL_sem* mWake;                         //!< Réveil du fil d'écriture
+        SDL_Thread* mThread;                    //!< Le fil d'écriture
+    };
+}
+
+#endif // LOGGER_HPP
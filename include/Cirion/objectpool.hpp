@@ -0,0 +1,79 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    objectpool.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Réserves d'objets de taille fixe.
+ */
+
+#ifndef OBJECTPOOL_HPP
+#define OBJECTPOOL_HPP
+
+#include <vector>
+#include <SDL2/SDL.h>
+
+#define OBJECTPOOL_CHUNK_OBJECTS 64 // Objets par bloc
+
+namespace cirion
+{
+    /**
+     * @class ObjectPool objectpool.hpp
+     *
+     * Une classe pour recycler la mémoire des objets d'un type créés et
+     * détruits en nombre (sprites, bulles). Les emplacements sont taillés
+     * dans des blocs de OBJECTPOOL_CHUNK_OBJECTS objets; un emplacement
+     * rendu est chaîné en tête de la liste libre, dans l'emplacement
+     * lui-même. Les blocs ne sont rendus au tas qu'à la destruction.
+     *
+     * La réserve sert les opérateurs new / delete des classes concernées:
+     * une classe dérivée plus grande retombe sur le tas.
+     */
+    class ObjectPool
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        ObjectPool( size_t objectSize );
+        ~ObjectPool();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void* acquire( size_t size );
+        void release( void* object, size_t size );
+        size_t getLiveCount();
+        size_t getReservedSize();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        std::vector<Uint8*> mChunks;  //!< Blocs réservés
+        void* mFree;                  //!< Tête de la liste libre
+        size_t mObjectSize;           //!< Taille d'un emplacement
+        size_t mLiveCount;            //!< Emplacements occupés
+    };
+}
+
+#endif // OBJECTPOOL_HPP
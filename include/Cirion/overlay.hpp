@@ -0,0 +1,84 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    overlay.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Incrustation des mesures de performance.
+ */
+
+#ifndef OVERLAY_HPP
+#define OVERLAY_HPP
+
+#include <SDL2/SDL.h>
+#include <Cirion/textbatch.hpp>
+
+#define OVERLAY_CAPACITY 512     // Caractères et rectangles par image
+#define OVERLAY_GRAPH_FRAMES 100 // Images du graphe des durées
+#define OVERLAY_GRAPH_HEIGHT 34  // Hauteur du graphe, en pixels (1 px / ms)
+
+namespace cirion
+{
+    /**
+     * @class Overlay overlay.hpp
+     *
+     * Une classe pour incruster les mesures de performance au dessus de
+     * l'image: cadence, graphe des durées d'images, appels de dessin,
+     * changements de texture, objets, mémoire des textures et rechargements
+     * en attente. L'incrustation n'alloue rien et se dessine en un appel:
+     * la laisser affichée ne fausse pas ce qu'elle mesure.
+     */
+    class Overlay
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        Overlay();
+        ~Overlay();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void create();
+        void toggle();
+        void setVisible( bool isVisible );
+        bool isVisible();
+        void draw();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        void drawGraph( int x, int y );
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        TextBatch mText;         //!< Texte et rectangles de l'image
+        bool mIsCreated;         //!< Indique la création de la police
+        bool mIsVisible;         //!< Indique l'affichage
+        Uint64 mDrawCalls;       //!< Appels de dessin au dernier affichage
+        Uint64 mTextureSwitches; //!< Changements de texture, idem
+    };
+}
+
+#endif // OVERLAY_HPP
@@ -0,0 +1,182 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    particlesystem.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Système de particules en perspective.
+ */
+
+#ifndef PARTICLESYSTEM_HPP
+#define PARTICLESYSTEM_HPP
+
+#include <string>
+#include <vector>
+#include <SDL2/SDL.h>
+
+// SDL_RenderGeometry() permet un envoi groupé par texture (SDL 2.0.18).
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+    #define PARTICLES_GEOMETRY
+#endif
+
+#define PARTICLES_GRAIN 4096 // Particules par tâche du système de tâches
+
+namespace cirion
+{
+    class Texture;
+
+    /**
+     * Une structure pour décrire un émetteur de particules. Les particules
+     * s'approchent de la caméra et sont projetées en perspective:
+     * écran = centre + position / profondeur. L'image affichée est la
+     * profondeur entière; au-delà de la dernière image de la texture, la
+     * particule est invisible.
+     */
+    typedef struct
+    {
+        std::string texture; // Nom de la texture
+        int count;           // Nombre de particules
+        int frameWidth;      // Largeur d'une image, en pixels
+        int frameHeight;     // Hauteur d'une image, en pixels
+        int frames;          // Nombre d'images, 0: déduit de la texture
+        float spreadX;       // Étendue des abscisses à profondeur 1
+        float spreadY;       // Étendue des ordonnées à profondeur 1
+        float depthMin;      // Profondeur minimale de la première génération
+        float depthMax;      // Profondeur maximale de la première génération
+        float depthReset;    // Profondeur des particules régénérées
+        float speed;         // Vitesse d'approche, en profondeur / ms
+    } EmitterConfig;
+
+    /**
+     * Une structure pour représenter un lot de particules partageant une
+     * texture, envoyé au renderer en une fois.
+     */
+    typedef struct
+    {
+        Texture* texture;
+        size_t first; // Première particule du lot dans le tampon de sommets
+        size_t count; // Nombre de particules du lot
+    } ParticleBatch;
+
+    void loadEmitterConfig( const char* name, EmitterConfig& config );
+
+    /**
+     * @class ParticleEmitter particlesystem.hpp
+     *
+     * Une classe pour animer les particules d'un émetteur. Les positions
+     * sont rangées par composante (x, y, profondeur) pour être traîtées par
+     * quatre (SSE2), et chaque particule a son propre générateur xorshift:
+     * la mise à jour, répartie sur les fils de travail, est identique quel
+     * que soit leur nombre.
+     */
+    class ParticleEmitter
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        ParticleEmitter();
+        ~ParticleEmitter();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void create( const EmitterConfig& config, Texture* texture,
+                     Uint32 seed = 0x2545F491 );
+        void update( float timeStep );
+        size_t project( float alpha = 1.0f );
+        Texture* getTexture();
+        const EmitterConfig& getConfig();
+        size_t getCount();
+        size_t getVisibleCount();
+        const float* getScreenX();
+        const float* getScreenY();
+        const int* getFrames();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        static void updateRange( void* data, size_t first, size_t last );
+        void advance( size_t first, size_t last );
+        void spawn( size_t i, bool randomDepth );
+        float random( size_t i );
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        EmitterConfig mConfig;       //!< La description de l'émetteur
+        Texture* mTexture;           //!< La texture des particules
+        float mTimeStep;             //!< Temps de la mise à jour en cours
+        std::vector<Uint32> mSeeds;  //!< États des générateurs xorshift
+        std::vector<float> mX;       //!< Abscisses, à profondeur 1
+        std::vector<float> mY;       //!< Ordonnées, à profondeur 1
+        std::vector<float> mZ;       //!< Profondeurs
+        std::vector<float> mScreenX; //!< Abscisses projetées des visibles
+        std::vector<float> mScreenY; //!< Ordonnées projetées des visibles
+        std::vector<int> mFrames;    //!< Images des visibles
+        size_t mVisibleCount;        //!< Nombre de particules visibles
+    };
+
+    /**
+     * @class ParticleSystem particlesystem.hpp
+     *
+     * Une classe pour mettre à jour et dessiner les émetteurs. Les
+     * émetteurs sont rangés par texture: chaque texture est dessinée en un
+     * seul appel à SDL_RenderGeometry().
+     */
+    class ParticleSystem
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        ParticleSystem();
+        ~ParticleSystem();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        ParticleEmitter* add( const char* name );
+        ParticleEmitter* add( const EmitterConfig& config, Texture* texture );
+        void clear();
+        void setSeed( Uint32 seed );
+        void update( float timeStep );
+        size_t prepare( float alpha = 1.0f );
+        void draw( float alpha = 1.0f );
+        size_t getCount();
+        size_t getBatchCount();
+        Uint32 getSeed();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        std::vector<ParticleEmitter*> mEmitters; //!< Émetteurs, par texture
+        std::vector<ParticleBatch> mBatches;     //!< Lots de l'image
+        Uint32 mSeed;                            //!< Graine des émetteurs
+        #ifdef PARTICLES_GEOMETRY
+        std::vector<SDL_Vertex> mVertices;       //!< Quatre sommets / particule
+        std::vector<int> mIndices;               //!< Six indices / particule
+        #endif // PARTICLES_GEOMETRY
+    };
+}
+
+#endif // PARTICLESYSTEM_HPP
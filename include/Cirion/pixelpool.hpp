@@ -18,47 +18,65 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+
 /**
- * @file    introbubble.hpp
- * @version 0.2.3
+ * @file    pixelpool.hpp
+ * @version 0.1
  * @author  Jérémy S. "Qwoak"
- * @date    01 Janvier 2016
- * @brief   Bulle utilisée dans l'introduction.
+ * @date    18 Octobre 2026
+ * @brief   Réserve de tampons de pixels.
  */
 
-#ifndef INTROBUBBLE_HPP
-#define INTROBUBBLE_HPP
+#ifndef PIXELPOOL_HPP
+#define PIXELPOOL_HPP
+
+#include <vector>
+#include <SDL2/SDL.h>
 
-#include <Cirion/gameobject.hpp>
-#include <Cirion/point3.hpp>
+#define PIXELPOOL_MIN_SHIFT 12 // Plus petite classe: 4 Kio
+#define PIXELPOOL_CLASSES   13 // Plus grande classe: 16 Mio
 
 namespace cirion
 {
-    class IntroBubble : public GameObject
+    /**
+     * @class PixelPool pixelpool.hpp
+     *
+     * Une classe pour recycler les tampons de pixels des traitements
+     * d'images transitoires (surfaces, cuisson des textures). Les tampons
+     * sont rangés par classes de tailles en puissances de deux; un tampon
+     * rendu retourne dans la liste libre de sa classe au lieu d'être libéré.
+     *
+     * Les tampons peuvent être obtenus et rendus depuis n'importe quel fil:
+     * le fil de chargement de gAssetWatcher cuit ses textures en parallèle.
+     */
+    class PixelPool
     {
         public:
         /* +----------------------------------------------------------------+
            ! Déclaration des constructeurs / déstructeurs.                  !
            +----------------------------------------------------------------+ */
-        IntroBubble();
-        ~IntroBubble();
+        PixelPool();
+        ~PixelPool();
         /* +----------------------------------------------------------------+
            ! Déclaration des méthodes publiques.                            !
            +----------------------------------------------------------------+ */
-        void create();
-        void update( int timeStep = 0 );
-        void handleEvent( SDL_Event* event = NULL );
+        void* acquire( size_t size );
+        void release( void* buffer, size_t size );
+        void clear();
+        size_t getReservedSize();
 
         private:
         /* +----------------------------------------------------------------+
            ! Déclaration des méthodes privées.                              !
            +----------------------------------------------------------------+ */
-        void regen( bool randomDepth = false );
+        static int getClass( size_t size );
         /* +----------------------------------------------------------------+
-           ! Déclaration des attributs privéss.                             !
+           ! Déclaration des attributs.                                     !
            +----------------------------------------------------------------+ */
-        Point3f mBubblePosition;
+        std::vector<void*> mFree[PIXELPOOL_CLASSES]; //!< Listes libres
+        size_t mReservedSize;                        //!< Octets réservés
+        SDL_SpinLock mLock;                          //!< Accès concurrents
     };
 }
 
-#endif // INTROBUBBLE_HPP
+#endif // PIXELPOOL_HPP
@@ -0,0 +1,166 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    profiler.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Zones de profilage et export de traces Chrome.
+ */
+
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <string>
+#include <SDL2/SDL.h>
+
+#define PROFILER_MAX_THREADS 65    // Fils tracés: principal et fils de travail
+#define PROFILER_BUFFER_SIZE 65536 // Évenements conservés par fil
+#define PROFILER_HOTKEY_FRAMES 120 // Images tracées par la touche F12
+
+/* Les macros d'instrumentation ne produisent aucun code sans PROFILE
+(make PROFILE=1). */
+#ifdef PROFILE
+    #define CIRION_PROFILE_CONCAT2( a, b ) a##b
+    #define CIRION_PROFILE_CONCAT( a, b ) CIRION_PROFILE_CONCAT2( a, b )
+    #define CIRION_PROFILE_ZONE( name ) \
+        cirion::ProfileZone CIRION_PROFILE_CONCAT( profileZone, __LINE__ )( name )
+    #define CIRION_PROFILE_COUNTER( name, value ) \
+        gProfiler.counter( name, (double)( value ) )
+    #define CIRION_PROFILE_FRAME() \
+        gProfiler.frame()
+#else
+    #define CIRION_PROFILE_ZONE( name )
+    #define CIRION_PROFILE_COUNTER( name, value )
+    #define CIRION_PROFILE_FRAME()
+#endif // PROFILE
+
+namespace cirion
+{
+    /**
+     * Les types d'évenements de profilage.
+     */
+    typedef enum
+    {
+        PROFILE_ZONE,
+        PROFILE_COUNTER,
+        PROFILE_FRAME
+    } ProfileEventType;
+
+    /**
+     * Une structure pour représenter un évenement de profilage. Le nom est
+     * une chaîne statique: il n'est pas copié.
+     */
+    typedef struct
+    {
+        const char* name;
+        Uint64 start;     // Compteur haute résolution
+        union
+        {
+            Uint64 end;   // Fin d'une zone
+            double value; // Valeur d'un compteur
+        };
+        ProfileEventType type;
+    } ProfileEvent;
+
+    /**
+     * Une structure pour représenter le tampon circulaire d'un fil. Seul son
+     * fil y écrit; le nombre d'évenements écrits est publié atomiquement.
+     */
+    typedef struct
+    {
+        ProfileEvent events[PROFILER_BUFFER_SIZE];
+        SDL_atomic_t written;
+    } ProfileBuffer;
+
+    /**
+     * @class Profiler profiler.hpp
+     *
+     * Une classe pour enregistrer des zones, compteurs et marqueurs d'images
+     * pendant un nombre d'images donné, puis les exporter au format JSON des
+     * traces Chrome (chrome://tracing, Perfetto).
+     *
+     * Chaque fil écrit dans son propre tampon, sans verrou. L'export a lieu
+     * sur le fil principal, à un marqueur d'image: les fils de travail n'ont
+     * alors plus de tâche en cours.
+     */
+    class Profiler
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        Profiler();
+        ~Profiler();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void capture( int frames, const char* filepath );
+        void frame();
+        void zone( const char* name, Uint64 start, Uint64 end );
+        void counter( const char* name, double value );
+        bool isCapturing();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        ProfileBuffer* getBuffer();
+        void record( const ProfileEvent& event );
+        void write();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        ProfileBuffer* mBuffers[PROFILER_MAX_THREADS]; //!< Tampons des fils
+        SDL_atomic_t mBufferCount;      //!< Nombre de tampons attribués
+        SDL_atomic_t mIsCapturing;      //!< Indique l'enregistrement
+        SDL_TLSID mTls;                 //!< Tampon du fil courant
+        int mRequestedFrames;           //!< Images à tracer, à la prochaine
+        int mRemainingFrames;           //!< Images restant à tracer
+        Uint64 mStartCounter;           //!< Compteur au début de la trace
+        std::string mFilepath;          //!< Fichier de la trace
+    };
+
+    /**
+     * @class ProfileZone profiler.hpp
+     *
+     * Une classe pour mesurer une zone: de la construction à la destruction.
+     */
+    class ProfileZone
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        ProfileZone( const char* name );
+        ~ProfileZone();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        const char* mName; //!< Nom de la zone
+        Uint64 mStart;     //!< Compteur à l'entrée, 0 hors enregistrement
+    };
+}
+
+#endif // PROFILER_HPP
@@ -0,0 +1,81 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    prototype.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Prototypes d'entités partagés.
+ */
+
+#ifndef PROTOTYPE_HPP
+#define PROTOTYPE_HPP
+
+#include <string>
+#include <Cirion/cef.hpp>
+#include <Cirion/sprite.hpp>
+
+namespace cirion
+{
+    /**
+     * @class EntityPrototype prototype.hpp
+     *
+     * Une classe pour partager, entre toutes les instances d'une même
+     * entité, les données en lecture seule de ses sprites: chargées une
+     * seule fois, elles ne sont libérées qu'à l'arrêt du moteur.
+     */
+    class EntityPrototype
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        EntityPrototype();
+        ~EntityPrototype();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void load( const char* name );
+        void reload();
+        void acquire();
+        void release();
+        const char* getName();
+        SpriteData* getSprite( const char* name );
+        unsigned int getInstanceCount();
+        size_t getSharedSize();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        std::string mName;           //!< Le nom de l'entité
+        Cef mCef;                    //!< Les données compilées de l'entité
+        unsigned int mInstanceCount; //!< Le nombre d'instances vivantes
+    };
+
+    EntityPrototype* findPrototype( const char* name );
+    EntityPrototype* getPrototype( const char* name );
+    void logPrototypes();
+    void freePrototypes();
+}
+
+#endif // PROTOTYPE_HPP
@@ -0,0 +1,281 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    registry.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Stockage des composants des objets en tableaux compacts.
+ */
+
+#ifndef REGISTRY_HPP
+#define REGISTRY_HPP
+
+#include <vector>
+#include <SDL2/SDL.h>
+#include <Cirion/point2.hpp>
+
+#define OBJECT_NONE 0xFFFFFFFF // Identifiant d'objet invalide
+#define REGISTRY_GRAIN 4096    // Composants par tâche du système de tâches
+
+namespace cirion
+{
+    class Texture;
+
+    /**
+     * L'identifiant d'un objet dans le registre. Les identifiants libérés
+     * sont réutilisés.
+     */
+    typedef Uint32 ObjectId;
+
+    /**
+     * Une structure pour représenter la position d'un objet, et celle du
+     * début de la mise à jour en cours pour l'interpolation du rendu.
+     */
+    typedef struct
+    {
+        Point2f position;
+        Point2f previous;
+    } Transform;
+
+    /**
+     * Une structure pour représenter la vitesse d'un objet, en pixels / ms.
+     */
+    typedef struct
+    {
+        Point2f velocity;
+    } Velocity;
+
+    /**
+     * Une structure pour représenter l'image d'un objet: le rectangle source
+     * dans la texture, le décalage des images rognées et le rang de dessin
+     * (l'ordre de création des images, qu'un retrait ne change pas).
+     */
+    typedef struct
+    {
+        Texture* texture;
+        SDL_Rect src;
+        Point2i offset;
+        Uint32 order;
+    } Renderable;
+
+    /**
+     * Une structure pour rattacher un objet à un objet parent (un sprite à
+     * son entité): la position est recopiée depuis celle du parent.
+     */
+    typedef struct
+    {
+        ObjectId parent;
+        Point2f relative;
+    } Attachment;
+
+    /**
+     * Une structure pour représenter une image à copier dans le renderer.
+     */
+    typedef struct
+    {
+        Texture* texture;
+        SDL_Rect src;
+        SDL_Rect dest;
+        Uint32 order;
+    } DrawCommand;
+
+    /**
+     * @class ComponentPool registry.hpp
+     *
+     * Une classe pour stocker un type de composant en ensemble clairsemé:
+     * les composants et les identifiants de leurs objets sont rangés en
+     * tableaux compacts, parcourus par les systèmes; un tableau indexé par
+     * identifiant donne l'indice de chaque composant. Un retrait déplace le
+     * dernier composant dans le trou.
+     */
+    template <typename Type> class ComponentPool
+    {
+    public:
+        //! @brief Procédure d'ajout (ou de remplacement) d'un composant.
+        //! @param id L'identifiant de l'objet.
+        //! @param component Le composant.
+        //! @return Référence vers le composant stocké.
+        Type& add( ObjectId id, const Type& component )
+        {
+            if( id >= mIndices.size() )
+            {
+                mIndices.resize( id + 1, -1 );
+            }
+
+            if( mIndices[id] != -1 )
+            {
+                mComponents[mIndices[id]] = component;
+                return mComponents[mIndices[id]];
+            }
+
+            mIndices[id] = (int)mComponents.size();
+            mIds.push_back( id );
+            mComponents.push_back( component );
+
+            return mComponents.back();
+        }
+
+        //! @brief Procédure de retrait d'un composant, s'il existe.
+        //! @param id L'identifiant de l'objet.
+        void remove( ObjectId id )
+        {
+            int index;
+            int last;
+
+            if( !has( id ) )
+            {
+                return;
+            }
+
+            index = mIndices[id];
+            last  = (int)mComponents.size() - 1;
+
+            mComponents[index]    = mComponents[last];
+            mIds[index]           = mIds[last];
+            mIndices[mIds[index]] = index;
+            mIndices[id]          = -1;
+
+            mComponents.pop_back();
+            mIds.pop_back();
+        }
+
+        //! @brief Procédure de retrait de tous les composants.
+        void clear()
+        {
+            mIndices.clear();
+            mIds.clear();
+            mComponents.clear();
+        }
+
+        //! @brief Fonction de test de présence d'un composant.
+        //! @param id L'identifiant de l'objet.
+        //! @return Vrai si l'objet a un composant de ce type.
+        bool has( ObjectId id ) const
+        {
+            return id < mIndices.size() && mIndices[id] != -1;
+        }
+
+        //! @brief Fonction accesseur; le composant doit exister.
+        //! @param id L'identifiant de l'objet.
+        //! @return Référence vers le composant.
+        Type& get( ObjectId id )
+        {
+            return mComponents[mIndices[id]];
+        }
+
+        //! @brief Fonction accesseur.
+        //! @return Le nombre de composants.
+        size_t getCount() const
+        {
+            return mComponents.size();
+        }
+
+        //! @brief Fonction accesseur.
+        //! @param i L'indice dans le tableau compact.
+        //! @return Référence vers le composant.
+        Type& at( size_t i )
+        {
+            return mComponents[i];
+        }
+
+        //! @brief Fonction accesseur.
+        //! @param i L'indice dans le tableau compact.
+        //! @return L'identifiant de l'objet du composant.
+        ObjectId getId( size_t i ) const
+        {
+            return mIds[i];
+        }
+
+    private:
+        std::vector<int> mIndices;       //!< Identifiant -> indice, ou -1
+        std::vector<ObjectId> mIds;      //!< Indice -> identifiant
+        std::vector<Type> mComponents;   //!< Composants
+    };
+
+    /**
+     * @class Registry registry.hpp
+     *
+     * Une classe pour attribuer les identifiants des objets et stocker leurs
+     * composants. Les systèmes (déplacement, rattachement, images, dessin)
+     * parcourent les tableaux compacts d'un seul balayage; GameObject n'est
+     * plus qu'une façade sur ces composants.
+     *
+     * Les états d'animation et les hitboxes restent dans gAnimationSystem et
+     * gCollisionSystem, déjà rangés en tableaux compacts.
+     */
+    class Registry
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        Registry();
+        ~Registry();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        ObjectId create();
+        void destroy( ObjectId id );
+        void clear();
+        void storePositions();
+        void updateMotion( float timeStep );
+        void updateAttachments();
+        void warp( ObjectId id, const Point2f& position );
+        void updateRenderables();
+        size_t cull( const Point2f& origin, float alpha = 1.0f );
+        void draw( const Point2f& origin, float alpha = 1.0f );
+        ComponentPool<Transform>& getTransforms();
+        ComponentPool<Velocity>& getVelocities();
+        ComponentPool<Renderable>& getRenderables();
+        ComponentPool<Attachment>& getAttachments();
+        ComponentPool<int>& getAnimations();
+        Uint32 getNextOrder();
+        size_t getCount();
+        bool isMoving();
+        static size_t getSlotSize();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        static void storeRange( void* data, size_t first, size_t last );
+        static void moveRange( void* data, size_t first, size_t last );
+        static void attachRange( void* data, size_t first, size_t last );
+        static void copyFramesRange( void* data, size_t first, size_t last );
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        ComponentPool<Transform> mTransforms;   //!< Positions
+        ComponentPool<Velocity> mVelocities;    //!< Vitesses
+        ComponentPool<Renderable> mRenderables; //!< Images
+        ComponentPool<Attachment> mAttachments; //!< Rattachements
+        ComponentPool<int> mAnimations;         //!< Poignées d'animation
+        std::vector<DrawCommand> mDrawList;     //!< Images visibles, en tête
+        std::vector<ObjectId> mFreeIds;         //!< Identifiants libres
+        ObjectId mNextId;                       //!< Prochain identifiant neuf
+        Uint32 mNextOrder;                      //!< Prochain rang de dessin
+        float mTimeStep;                        //!< Temps de la mise à jour
+    };
+}
+
+#endif // REGISTRY_HPP
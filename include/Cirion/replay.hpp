@@ -0,0 +1,123 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    replay.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Enregistrement et relecture des entrées.
+ */
+
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include <string>
+#include <vector>
+#include <SDL2/SDL.h>
+
+#define CRP_MAGIC      0x00505243 // "CRP\0"
+#define CRP_VERSION    2
+#define CRP_STATE_BITS 8          // Bits d'actions par segment
+#define CRP_MAX_RUN    0x00FFFFFF // Pas maximum par segment
+
+namespace cirion
+{
+    /**
+     * @struct CrpHeader
+     *
+     * L'en-tête d'un fichier d'entrées enregistrées. Les segments suivent
+     * immédiatement l'en-tête: un Uint32 chacun, l'état des actions dans
+     * l'octet de poids faible, le nombre de pas où il se répète dans les
+     * trois autres.
+     */
+    typedef struct
+    {
+        Uint32 magic;
+        Uint32 version;
+        Uint32 seed;
+        Uint32 rate;
+        Uint32 tickCount;
+        Uint32 runCount;
+        Uint32 checksum;
+        Uint32 reserved;
+    } CrpHeader;
+
+    /**
+     * @class Replay replay.hpp
+     *
+     * Une classe pour enregistrer l'état des actions à chaque pas de
+     * simulation, avec la graine des générateurs, puis le rejouer: la
+     * simulation à pas fixe refait alors exactement la même partie, pour
+     * comparer les temps d'image d'une version à l'autre.
+     *
+     * La somme de contrôle des positions en fin d'enregistrement est
+     * comparée à celle de la relecture: une divergence est reportée au
+     * journal.
+     */
+    class Replay
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        Replay();
+        ~Replay();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void record( const char* filepath );
+        void play( const char* filepath, bool isRealTime );
+        void stop();
+        Uint32 next( Uint32 state );
+        void setRate( int rate );
+        int getRate();
+        Uint32 getTickCount();
+        bool isRecording();
+        bool isPlaying();
+        bool isRealTime();
+        bool isFinished();
+        static Uint32 computeChecksum();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        void write();
+        void seed();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        std::vector<Uint32> mRuns;  //!< Segments (état, répétitions)
+        std::string mFilepath;      //!< Fichier enregistré
+        CrpHeader mHeader;          //!< En-tête du fichier
+        size_t mRun;                //!< Segment relu
+        Uint32 mRunTick;            //!< Pas relus dans le segment
+        Uint32 mTick;               //!< Pas enregistrés ou relus
+        Uint32 mChecksum;           //!< Somme de contrôle en fin de relecture
+        bool mIsRecording;          //!< Enregistrement en cours
+        bool mIsPlaying;            //!< Relecture en cours
+        bool mIsRealTime;           //!< Relecture au rythme de l'horloge
+        bool mIsFinished;           //!< Relecture achevée
+    };
+}
+
+#endif // REPLAY_HPP
@@ -29,7 +29,7 @@
 #ifndef SPRITE_HPP
 #define SPRITE_HPP
 
-#include <tinyxml2.h>
+#include <string>
 #include <vector>
 #include <Cirion/gameobject.hpp>
 #include <Cirion/point2.hpp>
@@ -44,6 +44,10 @@ namespace cirion
     {
         Point2i left;
         Point2i right;
+        /** Rognage du fragment gauche, relatif à la cellule */
+        SDL_Rect leftTrim;
+        /** Rognage du fragment droit, relatif à la cellule */
+        SDL_Rect rightTrim;
         int duration;
     } Frame;
 
@@ -52,39 +56,83 @@ namespace cirion
      */
     typedef struct
     {
-        const char* name;
+        char name[16];
         std::vector<Frame> frames;
     } Animation;
 
+    /**
+     * Une structure pour représenter une transition entre deux animations:
+     * prise si l'animation en cours est "from" (ou -1: toutes), que les
+     * drapeaux "require" sont levés et qu'aucun drapeau "forbid" ne l'est.
+     */
+    typedef struct
+    {
+        int from;
+        int to;
+        Uint32 require;
+        Uint32 forbid;
+    } Transition;
+
+    /**
+     * Une structure pour représenter les données d'un sprite, telles que
+     * compilées depuis le XML de l'entité.
+     */
+    typedef struct
+    {
+        char name[16];
+        char spritesheet[16];
+        int srcW;
+        int srcH;
+        SDL_Rect hitbox;
+        std::vector<Animation> animations;
+        int initialAnimation;
+        std::vector<Transition> transitions;
+    } SpriteData;
+
     /**
      * @class Sprite sprite.hpp
      *
-     * Une classe derivée pour manipuler des sprites.
+     * Une classe derivée pour manipuler des sprites. L'état d'animation est
+     * stocké et avancé par gAnimationSystem.
      */
     class Sprite : public GameObject
     {
     public:
         Sprite();
         ~Sprite();
-        void create( tinyxml2::XMLElement* spriteNode );
+        void create( const SpriteData& data );
         bool collide( Sprite* sprite );
         void handleEvent( SDL_Event* event = NULL );
-        void update( int timeStep = 0 );
+        void update( float timeStep = 0.0f );
+        void setParent( ObjectId parent );
         void setRelative( const Point2f& relative );
         void setFacingRight( bool facingRight );
+        void setAnimation( int id );
         void setAnimation( const char* name );
+        void setStateFlags( const Uint32* flags );
+        const char* getName();
+        int getAnimationId( const char* name );
+        int getAnimation();
+        const char* getAnimationName();
         Point2f getRelative();
         SDL_Rect getHitbox();
         bool isFacingRight();
+        size_t getInstanceSize();
+        static void* operator new( size_t size );
+        static void operator delete( void* object, size_t size );
     private:
-        Point2f mRelative;
+        void updateStateMachine();
+
+        std::string mName;
         SDL_Rect mHitbox;
         bool mCollidable;
-        bool mFacingRight;
-        int mEleapsed;
-        unsigned int mFrameIndex;
-        std::vector<Animation> mAnimations;
-        Animation* mAnimation;
+        const SpriteData* mData;
+        /** La poignée de l'état d'animation dans gAnimationSystem */
+        int mAnimationHandle;
+        /** La poignée du corps dans gCollisionSystem, ou -1 */
+        int mCollisionHandle;
+        /** Les drapeaux d'état de l'entité mère, ou NULL */
+        const Uint32* mStateFlags;
     };
 }
 
@@ -0,0 +1,41 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    spritetrim.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Rognage hors ligne des images de sprites.
+ */
+
+#ifndef SPRITETRIM_HPP
+#define SPRITETRIM_HPP
+
+#include <SDL2/SDL.h>
+
+namespace cirion
+{
+    SDL_Rect computeTrim( SDL_Surface* surface, int x, int y, int w, int h );
+    void trimEntity( const char* entityName );
+}
+
+#endif // SPRITETRIM_HPP
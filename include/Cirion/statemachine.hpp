@@ -0,0 +1,65 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    statemachine.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Machines à états des animations.
+ */
+
+#ifndef STATEMACHINE_HPP
+#define STATEMACHINE_HPP
+
+#include <SDL2/SDL.h>
+#include <Cirion/registry.hpp>
+#include <Cirion/sprite.hpp>
+
+namespace cirion
+{
+    /**
+     * Les drapeaux d'état d'une entité, testés par les transitions.
+     */
+    typedef enum
+    {
+        STATE_MOVING   = 1 << 0, //!< "moving": l'entité veut se déplacer
+        STATE_VELOCITY = 1 << 1, //!< "velocity": la vitesse n'est pas nulle
+        STATE_AIRBORNE = 1 << 2  //!< "airborne": l'entité ne touche pas le sol
+    } StateFlag;
+
+    /**
+     * Une structure pour rattacher la machine à états d'un sprite aux
+     * drapeaux de son entité. Seuls les sprites ayant des transitions en ont
+     * une, rangée dans gStateMachines sous l'identifiant du sprite.
+     */
+    typedef struct
+    {
+        const Uint32* flags;    //!< Les drapeaux de l'entité mère
+        const SpriteData* data; //!< Les transitions du sprite
+        int animation;          //!< La poignée dans gAnimationSystem
+    } StateMachine;
+
+    Uint32 parseStateFlags( const char* flags );
+    void updateStateMachines();
+}
+
+#endif // STATEMACHINE_HPP
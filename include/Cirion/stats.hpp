@@ -0,0 +1,87 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file    stats.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Compteurs de performance du moteur.
+ */
+
+#ifndef STATS_HPP
+#define STATS_HPP
+
+#include <SDL2/SDL.h>
+
+namespace cirion
+{
+    /**
+     * @struct Stats
+     *
+     * Une structure pour stocker les compteurs de performance du moteur.
+     */
+    typedef struct
+    {
+        /** Compteur de battements haute résolution au démarrage */
+        Uint64 startupCounter;
+        /** Nombre de textures chargées depuis le cache */
+        unsigned int textureCacheHits;
+        /** Nombre de textures (re)cuisinées depuis leur bitmap */
+        unsigned int textureCacheMisses;
+        /** Nombre de textures évincées de la mémoire vidéo */
+        unsigned int textureEvictions;
+        /** Nombre de textures recrées après une éviction */
+        unsigned int textureReloads;
+        /** Mémoire occupée par les textures résidentes, en octets */
+        size_t textureMemory;
+        /** Nombre d'entités chargées depuis leur version compilée */
+        unsigned int entityCacheHits;
+        /** Nombre d'entités (re)compilées depuis leur XML */
+        unsigned int entityCacheMisses;
+        /** Nombre de tampons de pixels recyclés par la réserve */
+        unsigned int pixelPoolHits;
+        /** Nombre de tampons de pixels alloués faute de tampon libre */
+        unsigned int pixelPoolMisses;
+        /** Nombre d'objets servis par la liste libre de leur réserve */
+        unsigned int objectPoolHits;
+        /** Nombre de blocs d'objets alloués faute d'emplacement libre */
+        unsigned int objectPoolMisses;
+        /** Nombre de blocs alloués par les arènes */
+        unsigned int arenaChunks;
+        /** Nombre de pas de simulation effectués */
+        unsigned int simulationTicks;
+        /** Temps de simulation abandonné pour ne pas s'enliser, en ms */
+        Uint64 simulationDropped;
+        /** Nombre d'appels de dessin envoyés au renderer */
+        Uint64 drawCalls;
+        /** Nombre de changements de texture entre deux appels de dessin */
+        Uint64 textureSwitches;
+        /** Nombre d'évenements passés au distributeur */
+        Uint64 eventsDispatched;
+        /** Nombre d'appels de gestionnaires d'évenements */
+        Uint64 eventDeliveries;
+    } Stats;
+
+    void resetStats();
+    void logStats();
+}
+
+#endif // STATS_HPP
@@ -67,6 +67,7 @@ namespace cirion
         void setBlendMode( SDL_BlendMode mode );
         void setAlphaMod( Uint8 alpha );
         void setRgbMod( Uint8 red, Uint8 green, Uint8 blue );
+        void release();
         SDL_Surface* getSdl2Surface();
         int getWidth();
         int getHeight();
@@ -76,6 +77,8 @@ namespace cirion
            ! Déclaration des attributs privés.                              !
            +----------------------------------------------------------------+ */
         SDL_Surface* mSurface; //!< La structure de surface SDL2
+        void* mPixels;         //!< Les pixels, empruntés à la réserve
+        size_t mPixelsSize;    //!< La taille des pixels, en octets
     };
 }
 
@@ -0,0 +1,110 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    textbatch.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Rendu groupé de texte en police bitmap.
+ */
+
+#ifndef TEXTBATCH_HPP
+#define TEXTBATCH_HPP
+
+#include <vector>
+#include <SDL2/SDL.h>
+#include <Cirion/texture.hpp>
+
+// SDL_RenderGeometry() permet un envoi en un seul lot (SDL 2.0.18).
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+    #define TEXT_GEOMETRY
+#endif
+
+#define TEXT_GLYPH_WIDTH 6   // Largeur d'un caractère de la police, en pixels
+#define TEXT_GLYPH_HEIGHT 10 // Hauteur d'un caractère de la police, en pixels
+#define TEXT_SOLID_X 92      // Texel plein de la police: la barre de '_'
+#define TEXT_SOLID_Y 58
+
+namespace cirion
+{
+    /**
+     * Une structure pour représenter un quadrilatère du texte, sans
+     * SDL_RenderGeometry().
+     */
+    typedef struct
+    {
+        SDL_Rect src;
+        SDL_Rect dest;
+        SDL_Color color;
+    } TextQuad;
+
+    /**
+     * @class TextBatch textbatch.hpp
+     *
+     * Une classe pour composer du texte et des rectangles unis avec une
+     * police bitmap (16 x 16 caractères ASCII de 6 x 10 pixels), et les
+     * dessiner en un seul appel. Les tampons sont alloués à la création: la
+     * composition d'une image n'alloue rien, le texte au delà de la capacité
+     * est ignoré.
+     */
+    class TextBatch
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        TextBatch();
+        ~TextBatch();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void create( const char* charset, size_t capacity );
+        void clear();
+        int print( int x, int y, const char* text, const SDL_Color& color );
+        void fill( const SDL_Rect& rect, const SDL_Color& color );
+        void draw();
+        size_t getCount();
+        size_t getCapacity();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        void push( const SDL_Rect& src,
+                   const SDL_Rect& dest,
+                   const SDL_Color& color );
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        Texture* mTexture;                 //!< Texture de la police
+        size_t mCount;                     //!< Quadrilatères composés
+        size_t mCapacity;                  //!< Quadrilatères au maximum
+        #ifdef TEXT_GEOMETRY
+        std::vector<SDL_Vertex> mVertices; //!< Quatre sommets / quadrilatère
+        std::vector<int> mIndices;         //!< Six indices / quadrilatère
+        #else
+        std::vector<TextQuad> mQuads;      //!< Quadrilatères à copier
+        #endif // TEXT_GEOMETRY
+    };
+}
+
+#endif // TEXTBATCH_HPP
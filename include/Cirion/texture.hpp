@@ -20,9 +20,9 @@
 
 /**
  * @file    texture.hpp
- * @version 0.5
+ * @version 0.6
  * @author  Jérémy S. "Qwoak" <qwoak11 at gmail dot com>
- * @date    25 Novembre 2015
+ * @date    18 Octobre 2026
  * @brief   Manipulation des textures.
  */
 
@@ -30,6 +30,7 @@
 #define TEXTURE_HPP
 
 #include <SDL2/SDL.h>
+#include <Cirion/cookedtexture.hpp>
 #include <Cirion/surface.hpp>
 
 namespace cirion
@@ -51,18 +52,28 @@ namespace cirion
            ! Déclaration des méthodes publiques.                            !
            +----------------------------------------------------------------+ */
         void create( Surface* surface );
+        void create( CookedTexture* cooked );
         void create( const char* name );
+        void update( CookedTexture* cooked, const SDL_Rect& rect );
+        void evict();
+        void swap( Texture& texture );
+        SDL_Texture* bind();
         void lock();
         void unlock();
         void setBlendMode( SDL_BlendMode mode );
         void setAlphaMod( Uint8 a );
         void setRgbMod( Uint8 r, Uint8 g, Uint8 b );
+        void setSourceHash( Uint32 hash );
         const char* getName();
         SDL_Texture* getSdl2Texture();
         int getWidth();
         int getHeight();
         void* getPixels();
         int getPitch();
+        size_t getMemorySize();
+        Uint32 getSourceHash();
+        Uint32 getLastUsedFrame();
+        bool isEvicted();
 
         private:
         /* +----------------------------------------------------------------+
@@ -76,7 +87,14 @@ namespace cirion
         SDL_Texture* mTexture; //!< La structure de texture SDL2
         void* mPixels;         //!< Pointeur vers les pixels vérouillés
         int mPitch;            //!< Pitch des pixels vérouillés
+        Uint32 mSourceHash;    //!< Empreinte du bitmap source des pixels
+        int mWidth;            //!< Largeur de la texture
+        int mHeight;           //!< Hauteur de la texture
+        Uint32 mLastUsedFrame; //!< Dernière image où la texture a été utilisée
+        bool mIsEvicted;       //!< Indique si la texture a été évincée
     };
+
+    Texture* getTexture( const char* name );
 }
 
 #endif // TEXTURE_HPP
@@ -0,0 +1,127 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    tilemap.hpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Collisions des corps contre la grille de tuiles.
+ */
+
+#ifndef TILEMAP_HPP
+#define TILEMAP_HPP
+
+#include <SDL2/SDL.h>
+#include <Cirion/arena.hpp>
+#include <Cirion/cmf.hpp>
+#include <Cirion/point2.hpp>
+
+#define TILEMAP_TILES 256 // Nombre de tuiles d'un tileset
+
+namespace cirion
+{
+    /**
+     * Les types de tuiles, lus depuis le fichier de drapeaux du tileset.
+     */
+    typedef enum
+    {
+        TILE_EMPTY,  // Traversable
+        TILE_SOLID,  // Bloquante de tous côtés
+        TILE_ONEWAY, // Bloquante par le dessus seulement
+        TILE_SLOPE   // Sol en pente, suivi par le centre du corps
+    } TileType;
+
+    /**
+     * Les contacts rencontrés lors d'un déplacement.
+     */
+    typedef enum
+    {
+        TILE_CONTACT_GROUND  = 1 << 0,
+        TILE_CONTACT_WALL    = 1 << 1,
+        TILE_CONTACT_CEILING = 1 << 2
+    } TileContact;
+
+    /**
+     * Une structure pour représenter les drapeaux d'une tuile. Les hauteurs
+     * d'une pente sont mesurées depuis le bas de la tuile, à ses bords
+     * gauche et droit.
+     */
+    typedef struct
+    {
+        Uint8 type;
+        Uint8 left;
+        Uint8 right;
+    } TileFlags;
+
+    /**
+     * @class TileMap tilemap.hpp
+     *
+     * Une classe pour déplacer des boîtes englobantes contre la grille de
+     * tuiles du monde. Seules les tuiles traversées par le déplacement sont
+     * lues, depuis des plans de bits (un bit par tuile) construits au
+     * chargement de la map.
+     */
+    class TileMap
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        TileMap();
+        ~TileMap();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes publiques.                            !
+           +----------------------------------------------------------------+ */
+        void loadFlags( const char* tileset );
+        void setFlags( unsigned char tile, const TileFlags& flags );
+        void build( Cmf& cmf, Arena& arena );
+        void build( int width, int height, const Uint8* tiles, Arena& arena );
+        Uint32 move( Point2f& position, const SDL_Rect& hitbox,
+                     const Point2f& delta, bool isGrounded );
+        int getWidth();
+        int getHeight();
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes privées.                              !
+           +----------------------------------------------------------------+ */
+        void buildPlanes( Arena& arena );
+        bool testRow( const Uint32* plane, int row, int first, int last );
+        bool isSolidRow( int row, int first, int last );
+        bool isOneWayRow( int row, int first, int last );
+        bool isSolidColumn( int column, int first, int last );
+        bool findSlope( int row, float x, float* surface );
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        TileFlags mFlags[TILEMAP_TILES]; //!< Drapeaux des tuiles
+        int mWidth;                      //!< Largeur, en tuiles
+        int mHeight;                     //!< Hauteur, en tuiles
+        int mPitch;                      //!< Mots de 32 bits par rangée
+        Uint8* mTiles;                   //!< Index des tuiles
+        Uint32* mSolid;                  //!< Plan des tuiles pleines
+        Uint32* mOneWay;                 //!< Plan des plateformes
+        Uint32* mSlopes;                 //!< Plan des pentes
+    };
+}
+
+#endif // TILEMAP_HPP
@@ -62,6 +62,38 @@ namespace cirion
         Uint32 mStartTicks; //!< Compteur de battements au démarrage
         Uint32 mStopTicks;  //!< Compteur de battements à l'arrêt
     };
+
+    /**
+     * @class HrTimer timer.hpp
+     *
+     * Une classe pour mesurer l'écoulement du temps à la nanoseconde, sur le
+     * compteur haute résolution.
+     */
+    class HrTimer
+    {
+        public:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des constructeurs / déstructeurs.                  !
+           +----------------------------------------------------------------+ */
+        HrTimer();
+        /* +----------------------------------------------------------------+
+           ! Déclaration des méthodes.                                      !
+           +----------------------------------------------------------------+ */
+        bool isRunning();
+        void start();
+        void stop();
+        void reset();
+        Uint64 getNanoseconds();
+        static Uint64 toNanoseconds( Uint64 counter );
+
+        private:
+        /* +----------------------------------------------------------------+
+           ! Déclaration des attributs.                                     !
+           +----------------------------------------------------------------+ */
+        bool mRunning;        //!< Drapeau de mise en fonction
+        Uint64 mStartCounter; //!< Compteur haute résolution au démarrage
+        Uint64 mStopCounter;  //!< Battements écoulés à l'arrêt
+    };
 }
 
 #endif // TIMER_HPP
@@ -32,12 +32,15 @@
 #define TILE_H 16
 
 #include <fstream>
+#include <string>
 #include <vector>
+#include <Cirion/arena.hpp>
 #include <Cirion/cmf.hpp>
 #include <Cirion/gameobject.hpp>
 #include <Cirion/point2.hpp>
 #include <Cirion/surface.hpp>
 #include <Cirion/texture.hpp>
+#include <Cirion/tilemap.hpp>
 
 extern const int tileWidth;
 extern const int tileHeight;
@@ -55,19 +58,29 @@ namespace cirion
         World();
         ~World();
         void create( const char* name );
-        void handleEvent( SDL_Event* event = NULL );
-        void update( int timeStep = 0 );
-        void draw();
+        void update( float timeStep = 0.0f );
+        void draw( float alpha = 1.0f );
+        void findTextures( const char* name, std::vector<Texture*>& textures );
+        const char* getName();
+        TileMap& getTileMap();
+        size_t getTextureMemorySize();
+        Arena& getArena();
 
     private:
         void drawBackground();
         void drawMap();
-        void drawObjects();
+        void drawObjects( float alpha );
 
+        /** Le nom du fichier CMF du monde */
+        std::string mName;
         /** Position dans le monde */
         Point2f mPosition;
         /** Les données de la map */
         Cmf mCmf;
+        /** L'arène des données du niveau, rendue à chaque chargement */
+        Arena mArena;
+        /** La grille de collision de la map */
+        TileMap mTileMap;
         /** La texture du tileset */
         Texture mTileset;
         /** La texture du background */
@@ -80,8 +93,6 @@ namespace cirion
         SDL_Rect mBackgroundSrc;
         /** Repère de destination du background */
         SDL_Rect mBackgroundDest;
-        /** Vecteur des objets contenu dans le monde */
-        std::vector<GameObject*> mObjects;
     };
 }
 
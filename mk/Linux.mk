@@ -33,20 +33,45 @@ endif
 
 # Définition de la liste des objets à construire.
 OBJS = \
+	animationsystem.cpp.o \
+	arena.cpp.o \
+	assetwatcher.cpp.o \
+	bench.cpp.o \
+	cef.cpp.o \
 	ciexception.cpp.o \
 	cirion.cpp.o \
 	cmf.cpp.o \
+	collisionsystem.cpp.o \
 	config.cpp.o \
+	cookedtexture.cpp.o \
 	demo.cpp.o \
 	entity.cpp.o \
+	eventdispatcher.cpp.o \
+	framepacer.cpp.o \
+	framestats.cpp.o \
 	gameobject.cpp.o \
 	graphic.cpp.o \
 	hiro.cpp.o \
-	introbubble.cpp.o \
+	inputsystem.cpp.o \
+	jobsystem.cpp.o \
 	log.cpp.o \
+	logger.cpp.o \
+	objectpool.cpp.o \
+	overlay.cpp.o \
+	particlesystem.cpp.o \
+	pixelpool.cpp.o \
+	profiler.cpp.o \
+	prototype.cpp.o \
+	registry.cpp.o \
+	replay.cpp.o \
 	sprite.cpp.o \
+	spritetrim.cpp.o \
+	statemachine.cpp.o \
+	stats.cpp.o \
 	surface.cpp.o \
+	textbatch.cpp.o \
 	texture.cpp.o \
+	tilemap.cpp.o \
 	timer.cpp.o \
 	world.cpp.o \
 	xmlerror.cpp.o
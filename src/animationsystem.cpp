@@ -0,0 +1,316 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    animationsystem.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Avancement groupé des animations des sprites.
+ */
+
+#include <cmath>
+#include <Cirion/animationsystem.hpp>
+#include <Cirion/cirion.hpp>
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe AnimationSystem.
+cirion::AnimationSystem::AnimationSystem():
+    mTimeStep( 0.0f )
+{
+}
+
+//! @brief Déstructeur pour la classe AnimationSystem.
+cirion::AnimationSystem::~AnimationSystem()
+{
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Fonction d'ajout d'un sprite, sur son animation initiale.
+//! @param data Les données du sprite, qui doivent lui survivre.
+//! @return La poignée du sprite.
+int cirion::AnimationSystem::add( const SpriteData* data )
+{
+    int handle;
+
+    if( !mFreeHandles.empty() )
+    {
+        handle = mFreeHandles.back();
+        mFreeHandles.pop_back();
+    }
+
+    else
+    {
+        handle = (int)mIndices.size();
+        mIndices.push_back( -1 );
+    }
+
+    mIndices[handle] = (int)mData.size();
+
+    mData.push_back( data );
+    mAnimationIds.push_back( data->initialAnimation );
+    mFrameIndices.push_back( 0 );
+    mElapsed.push_back( 0 );
+    mFacingRight.push_back( 0 );
+    mSrcs.push_back( SDL_Rect() );
+    mOffsets.push_back( Point2i( 0, 0 ) );
+    mHandles.push_back( handle );
+
+    writeFrame( mData.size() - 1 );
+
+    return handle;
+}
+
+//! @brief Procédure de retrait d'un sprite.
+//!
+//! Le dernier sprite prend la place du sprite retiré: l'ordre n'est pas
+//! conservé, les tableaux restent compacts.
+//! @param handle La poignée du sprite.
+void cirion::AnimationSystem::remove( int handle )
+{
+    size_t i    = (size_t)mIndices[handle];
+    size_t last = mData.size() - 1;
+
+    if( i != last )
+    {
+        mData[i]         = mData[last];
+        mAnimationIds[i] = mAnimationIds[last];
+        mFrameIndices[i] = mFrameIndices[last];
+        mElapsed[i]      = mElapsed[last];
+        mFacingRight[i]  = mFacingRight[last];
+        mSrcs[i]         = mSrcs[last];
+        mOffsets[i]      = mOffsets[last];
+        mHandles[i]      = mHandles[last];
+
+        mIndices[mHandles[i]] = (int)i;
+    }
+
+    mData.pop_back();
+    mAnimationIds.pop_back();
+    mFrameIndices.pop_back();
+    mElapsed.pop_back();
+    mFacingRight.pop_back();
+    mSrcs.pop_back();
+    mOffsets.pop_back();
+    mHandles.pop_back();
+
+    mIndices[handle] = -1;
+    mFreeHandles.push_back( handle );
+}
+
+//! @brief Procédure de retrait de tous les sprites.
+void cirion::AnimationSystem::clear()
+{
+    mData.clear();
+    mAnimationIds.clear();
+    mFrameIndices.clear();
+    mElapsed.clear();
+    mFacingRight.clear();
+    mSrcs.clear();
+    mOffsets.clear();
+    mHandles.clear();
+    mIndices.clear();
+    mFreeHandles.clear();
+}
+
+//! @brief Procédure d'avancement de toutes les animations.
+//!
+//! Comme auparavant, une animation avance d'au plus une image par mise à
+//! jour; le reste du temps écoulé est conservé.
+//! @param timeStep Le temps écoulé depuis la dernière mise à jour, en ms.
+void cirion::AnimationSystem::update( float timeStep )
+{
+    CIRION_PROFILE_ZONE( "AnimationSystem::update" );
+
+    // Chaque sprite n'écrit que ses propres tableaux: réparti par intervalles.
+    mTimeStep = timeStep;
+    gJobSystem.parallelFor( mData.size(), ANIMATIONS_GRAIN, updateRange, this );
+}
+
+//! @brief Procédure de changement des données d'un sprite recrée.
+//! @param handle La poignée du sprite.
+//! @param data Les nouvelles données du sprite.
+void cirion::AnimationSystem::setData( int handle, const SpriteData* data )
+{
+    mData[mIndices[handle]] = data;
+    setAnimation( handle, data->initialAnimation );
+}
+
+//! @brief Procédure de changement d'animation, depuis la première image.
+//! @param handle La poignée du sprite.
+//! @param id L'identifiant de l'animation, déjà vérifié par le sprite.
+void cirion::AnimationSystem::setAnimation( int handle, int id )
+{
+    size_t i = (size_t)mIndices[handle];
+
+    mAnimationIds[i] = id;
+    mFrameIndices[i] = 0;
+    mElapsed[i]      = 0;
+    writeFrame( i );
+}
+
+//! @brief Procédure de changement d'orientation.
+//! @param handle La poignée du sprite.
+//! @param facingRight Vrai si le sprite regarde à droite.
+void cirion::AnimationSystem::setFacingRight( int handle, bool facingRight )
+{
+    size_t i = (size_t)mIndices[handle];
+
+    if( mFacingRight[i] != (Uint8)facingRight )
+    {
+        mFacingRight[i] = facingRight;
+        writeFrame( i );
+    }
+}
+
+//! @brief Fonction accesseur.
+//! @param handle La poignée du sprite.
+//! @return L'identifiant de l'animation en cours.
+int cirion::AnimationSystem::getAnimation( int handle )
+{
+    return mAnimationIds[mIndices[handle]];
+}
+
+//! @brief Fonction accesseur.
+//! @param handle La poignée du sprite.
+//! @return L'orientation du sprite.
+bool cirion::AnimationSystem::isFacingRight( int handle )
+{
+    return mFacingRight[mIndices[handle]] != 0;
+}
+
+//! @brief Fonction accesseur.
+//! @param handle La poignée du sprite.
+//! @return Le rectangle source de l'image en cours, rognée.
+const SDL_Rect& cirion::AnimationSystem::getSrc( int handle )
+{
+    return mSrcs[mIndices[handle]];
+}
+
+//! @brief Fonction accesseur.
+//! @param handle La poignée du sprite.
+//! @return Le décalage du rognage dans la cellule de l'image en cours.
+const Point2i& cirion::AnimationSystem::getOffset( int handle )
+{
+    return mOffsets[mIndices[handle]];
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre de sprites animés.
+size_t cirion::AnimationSystem::getCount()
+{
+    return mData.size();
+}
+
+//! @brief Fonction de test d'animation en cours.
+//! @return Vrai si un sprite joue une animation de plusieurs images.
+bool cirion::AnimationSystem::isAnimating()
+{
+    for( size_t i = 0; i != mData.size(); i++ )
+    {
+        const Animation& animation = mData[i]->animations[mAnimationIds[i]];
+
+        if(    animation.frames.size() > 1
+            && animation.frames[mFrameIndices[i]].duration != 0 )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//! @brief Fonction de calcul de la mémoire occupée par un sprite.
+//! @return La taille en octets, hors capacité inutilisée des tableaux.
+size_t cirion::AnimationSystem::getSlotSize()
+{
+    return sizeof(const SpriteData*) + sizeof(int) + sizeof(Uint32)
+         + sizeof(int) + sizeof(Uint8) + sizeof(SDL_Rect) + sizeof(Point2i)
+         + 2 * sizeof(int);
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées.                                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de mise à jour d'un intervalle, pour le système de
+//! tâches.
+//! @param data Pointeur vers le système d'animations.
+//! @param first Le premier sprite.
+//! @param last Après le dernier sprite.
+void cirion::AnimationSystem::updateRange( void* data, size_t first, size_t last )
+{
+    ( (AnimationSystem*)data )->advance( first, last );
+}
+
+//! @brief Procédure d'avancement des animations d'un intervalle.
+//! @param first Le premier sprite.
+//! @param last Après le dernier sprite.
+void cirion::AnimationSystem::advance( size_t first, size_t last )
+{
+    for( size_t i = first; i != last; i++ )
+    {
+        const Animation& animation = mData[i]->animations[mAnimationIds[i]];
+        int              duration  = animation.frames[mFrameIndices[i]].duration;
+        float            elapsed   = mElapsed[i] + mTimeStep;
+
+        if( duration != 0 && elapsed >= (float)duration )
+        {
+            mElapsed[i]      = fmod( elapsed, (float)duration );
+            mFrameIndices[i] = mFrameIndices[i] + 1 == animation.frames.size()
+                             ? 0
+                             : mFrameIndices[i] + 1;
+            writeFrame( i );
+        }
+
+        else
+        {
+            mElapsed[i] = elapsed;
+        }
+    }
+}
+
+//! @brief Procédure d'écriture du rectangle source de l'image en cours.
+//! @param i L'indice du sprite dans les tableaux.
+void cirion::AnimationSystem::writeFrame( size_t i )
+{
+    const Frame&    frame = mData[i]->animations[mAnimationIds[i]]
+                            .frames[mFrameIndices[i]];
+    const Point2i&  cell  = mFacingRight[i] ? frame.right     : frame.left;
+    const SDL_Rect& trim  = mFacingRight[i] ? frame.rightTrim : frame.leftTrim;
+
+    // Seul le rectangle opaque de la cellule est copié.
+    mSrcs[i].x      = cell.mX + trim.x;
+    mSrcs[i].y      = cell.mY + trim.y;
+    mSrcs[i].w      = trim.w;
+    mSrcs[i].h      = trim.h;
+    mOffsets[i].mX  = trim.x;
+    mOffsets[i].mY  = trim.y;
+}
@@ -0,0 +1,143 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    arena.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Allocation linéaire des données d'un niveau.
+ */
+
+#include <Cirion/arena.hpp>
+#include <Cirion/cirion.hpp>
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe Arena.
+//! @param chunkSize La taille par défaut des blocs, en octets.
+cirion::Arena::Arena( size_t chunkSize ):
+    mChunkSize( chunkSize ),
+    mChunk    ( 0 ),
+    mOffset   ( 0 ),
+    mUsedSize ( 0 )
+{
+}
+
+//! @brief Déstructeur pour la classe Arena.
+cirion::Arena::~Arena()
+{
+    clear();
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Fonction d'allocation d'une zone non initialisée.
+//!
+//! Les blocs déjà réservés sont réutilisés dans l'ordre; un nouveau bloc
+//! n'est pris sur le tas que si aucun ne convient.
+//! @param size La taille de la zone, en octets.
+//! @param alignment L'alignement, puissance de deux.
+//! @return Pointeur vers la zone.
+void* cirion::Arena::allocate( size_t size, size_t alignment )
+{
+    while( mChunk < mChunks.size() )
+    {
+        size_t base   = (size_t)mChunks[mChunk];
+        size_t offset = ( ( base + mOffset + alignment - 1 )
+                          & ~( alignment - 1 ) ) - base;
+
+        if( offset + size <= mSizes[mChunk] )
+        {
+            mOffset    = offset + size;
+            mUsedSize += size;
+
+            return mChunks[mChunk] + offset;
+        }
+
+        mChunk++;
+        mOffset = 0;
+    }
+
+    // Nouveau bloc, assez grand pour les grosses zones.
+    size_t chunkSize = size + alignment > mChunkSize
+                     ? size + alignment
+                     : mChunkSize;
+
+    mChunks.push_back( new Uint8[chunkSize] );
+    mSizes.push_back( chunkSize );
+    gStats.arenaChunks++;
+
+    mChunk  = mChunks.size() - 1;
+    mOffset = 0;
+
+    return allocate( size, alignment );
+}
+
+//! @brief Procédure de libération de toutes les zones, en O(1): les blocs
+//!        sont gardés.
+void cirion::Arena::reset()
+{
+    mChunk    = 0;
+    mOffset   = 0;
+    mUsedSize = 0;
+}
+
+//! @brief Procédure de libération des zones et des blocs.
+void cirion::Arena::clear()
+{
+    for( size_t i = 0; i != mChunks.size(); i++ )
+    {
+        delete[] mChunks[i];
+    }
+
+    mChunks.clear();
+    mSizes.clear();
+    reset();
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre d'octets alloués depuis le dernier reset().
+size_t cirion::Arena::getUsedSize()
+{
+    return mUsedSize;
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre d'octets réservés par les blocs.
+size_t cirion::Arena::getReservedSize()
+{
+    size_t size = 0;
+
+    for( size_t i = 0; i != mSizes.size(); i++ )
+    {
+        size += mSizes[i];
+    }
+
+    return size;
+}
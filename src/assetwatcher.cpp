@@ -0,0 +1,736 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file    assetwatcher.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Rechargement à chaud des ressources.
+ */
+
+#include <cstdio>  // rename(), remove()
+#include <cstring> // memset()
+#include <sstream>
+#include <string>
+#include <vector>
+#include <Cirion/assetwatcher.hpp>
+#include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/entity.hpp>
+#include <Cirion/log.hpp>
+#include <Cirion/prototype.hpp>
+#include <Cirion/surface.hpp>
+#include <Cirion/texture.hpp>
+
+#ifdef __linux__
+    #include <sys/inotify.h>
+    #include <unistd.h> // read(), close()
+#endif
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe AssetWatcher.
+cirion::AssetWatcher::AssetWatcher():
+    mFd              ( -1 ),
+    mTexturesWatch   ( -1 ),
+    mCmfsWatch       ( -1 ),
+    mEntitiesWatch   ( -1 ),
+    mLoader          ( NULL ),
+    mLoaderWake      ( NULL ),
+    mLoadHash        ( 0 ),
+    mLoadPreviousHash( 0 ),
+    mIsLoadCached    ( false ),
+    mUploadRow       ( 0 ),
+    mUploadEnd       ( 0 )
+{
+    SDL_AtomicSet( &mIsLoaderRunning, 0 );
+    SDL_AtomicSet( &mLoaderState, LOADER_IDLE );
+    memset( &mLoadRect, 0x00, sizeof(SDL_Rect) );
+}
+
+//! @brief Déstructeur pour la classe AssetWatcher.
+cirion::AssetWatcher::~AssetWatcher()
+{
+    stop();
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de démarrage de la surveillance.
+//!
+//! Sans fil de chargement, les textures sont lues et cuites par le fil
+//! principal, en une étape.
+//! @param workingDir Le répertoire des ressources.
+void cirion::AssetWatcher::start( const char* workingDir )
+{
+    #ifdef __linux__
+
+    string root( workingDir );
+    /* Les éditeurs écrivent soit en place, soit dans un fichier temporaire
+    renommé ensuite. */
+    Uint32 mask = IN_CLOSE_WRITE | IN_MOVED_TO;
+
+    stop();
+
+    mFd = inotify_init1( IN_NONBLOCK | IN_CLOEXEC );
+
+    if( mFd == -1 )
+    {
+        log( "Unable to start hot-reload: inotify_init1() failed.",
+            __PRETTY_FUNCTION__ );
+        return;
+    }
+
+    mTexturesWatch = inotify_add_watch( mFd, ( root + "/Textures" ).c_str(), mask );
+    mCmfsWatch     = inotify_add_watch( mFd, ( root + "/Cmfs"     ).c_str(), mask );
+    mEntitiesWatch = inotify_add_watch( mFd, ( root + "/Entities" ).c_str(), mask );
+
+    // --- Fil de chargement des textures. -------------------------------------
+    mLoaderWake = SDL_CreateSemaphore( 0 );
+
+    if( mLoaderWake != NULL )
+    {
+        SDL_AtomicSet( &mIsLoaderRunning, 1 );
+        mLoader = SDL_CreateThread( loadTextures, "CirionLoader", this );
+
+        if( mLoader == NULL )
+        {
+            SDL_AtomicSet( &mIsLoaderRunning, 0 );
+            SDL_DestroySemaphore( mLoaderWake );
+            mLoaderWake = NULL;
+        }
+    }
+
+    if( mLoader == NULL )
+    {
+        log( "Unable to start the texture loader: textures will be reloaded "
+             "on the main thread.", __PRETTY_FUNCTION__ );
+    }
+
+    log( "Hot-reload enabled.", __PRETTY_FUNCTION__ );
+
+    #else
+
+    log( "Hot-reload is not supported on this platform.", __PRETTY_FUNCTION__ );
+
+    #endif // __linux__
+}
+
+//! @brief Procédure d'arrêt de la surveillance.
+//!
+//! Une texture en cours de cuisson est attendue; son envoi est abandonné.
+void cirion::AssetWatcher::stop()
+{
+    #ifdef __linux__
+
+    if( mFd != -1 )
+    {
+        close( mFd );
+    }
+
+    #endif // __linux__
+
+    if( mLoader != NULL )
+    {
+        SDL_AtomicSet( &mIsLoaderRunning, 0 );
+        SDL_SemPost( mLoaderWake );
+        SDL_WaitThread( mLoader, NULL );
+        SDL_DestroySemaphore( mLoaderWake );
+        mLoader     = NULL;
+        mLoaderWake = NULL;
+    }
+
+    mFd            = -1;
+    mTexturesWatch = -1;
+    mCmfsWatch     = -1;
+    mEntitiesWatch = -1;
+    mPending.clear();
+    mUploads.clear();
+    mLoadCooked.clear();
+    SDL_AtomicSet( &mLoaderState, LOADER_IDLE );
+}
+
+//! @brief Procédure de traîtement des modifications, entre deux images.
+//!
+//! Les étapes s'enchaînent tant que le budget n'est pas épuisé; le reste
+//! attend l'image suivante. Une étape au moins est faite par image: un
+//! budget nul ralentit le rechargement sans l'arrêter.
+//! @param budget Temps consacré aux rechargements, en ms.
+void cirion::AssetWatcher::poll( int budget )
+{
+    CIRION_PROFILE_ZONE( "AssetWatcher::poll" );
+
+    Uint64 start     = SDL_GetPerformanceCounter();
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+
+    if( mFd == -1 )
+    {
+        return;
+    }
+
+    readEvents();
+
+    while( step() )
+    {
+        if(    ( SDL_GetPerformanceCounter() - start ) * 1000000 / frequency
+            >= (Uint64)( budget > 0 ? budget : 0 ) * 1000 )
+        {
+            break;
+        }
+    }
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre de ressources en attente de rechargement, texture en
+//! cours de chargement ou d'envoi comprise.
+size_t cirion::AssetWatcher::getPendingCount()
+{
+    return mPending.size()
+         + ( SDL_AtomicGet( &mLoaderState ) != LOADER_IDLE ? 1 : 0 );
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées.                                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Fonction principale du fil de chargement des textures.
+//! @param data Pointeur vers la surveillance.
+//! @return 0.
+int cirion::AssetWatcher::loadTextures( void* data )
+{
+    AssetWatcher* watcher = (AssetWatcher*)data;
+
+    for( ;; )
+    {
+        SDL_SemWait( watcher->mLoaderWake );
+
+        if( SDL_AtomicGet( &watcher->mIsLoaderRunning ) == 0 )
+        {
+            break;
+        }
+
+        if( SDL_AtomicGet( &watcher->mLoaderState ) == LOADER_BUSY )
+        {
+            watcher->prepareTexture();
+            SDL_AtomicSet( &watcher->mLoaderState, LOADER_DONE );
+        }
+    }
+
+    return 0;
+}
+
+//! @brief Procédure de lecture des évenements inotify en attente.
+void cirion::AssetWatcher::readEvents()
+{
+    #ifdef __linux__
+
+    char    buffer[4096] __attribute__(( aligned( __alignof__( struct inotify_event ) ) ));
+    ssize_t length;
+
+    while( ( length = read( mFd, buffer, sizeof(buffer) ) ) > 0 )
+    {
+        for( char* p = buffer; p < buffer + length; )
+        {
+            struct inotify_event* event = (struct inotify_event*)p;
+            p += sizeof(struct inotify_event) + event->len;
+
+            if( event->len == 0 )
+            {
+                continue;
+            }
+
+            string file( event->name );
+            size_t dot = file.find_last_of( '.' );
+
+            if( dot == string::npos )
+            {
+                continue;
+            }
+
+            string name      = file.substr( 0, dot );
+            string extension = file.substr( dot + 1 );
+
+            if( event->wd == mTexturesWatch && extension == "bmp" )
+            {
+                queue( ASSET_TEXTURE, name );
+            }
+
+            else if( event->wd == mCmfsWatch && extension == "cmf" )
+            {
+                queue( ASSET_CMF, name );
+            }
+
+            else if( event->wd == mEntitiesWatch && extension == "xml" )
+            {
+                queue( ASSET_ENTITY, name );
+            }
+        }
+    }
+
+    #endif // __linux__
+}
+
+//! @brief Procédure de mise en attente d'une ressource, sans doublon.
+//! @param type Le type de la ressource.
+//! @param name Le nom de la ressource.
+void cirion::AssetWatcher::queue( AssetType type, const string& name )
+{
+    PendingAsset asset;
+
+    for( size_t i = 0; i != mPending.size(); i++ )
+    {
+        if( mPending[i].type == type && mPending[i].name == name )
+        {
+            return;
+        }
+    }
+
+    asset.type = type;
+    asset.name = name;
+    mPending.push_back( asset );
+}
+
+//! @brief Fonction d'exécution d'une étape de rechargement.
+//! @return Faux s'il n'y a rien à faire pour l'instant.
+bool cirion::AssetWatcher::step()
+{
+    PendingAsset asset;
+
+    // --- Une bande de la texture en cours d'envoi. ---------------------------
+    if( !mUploads.empty() )
+    {
+        uploadBand();
+        return true;
+    }
+
+    // --- Une texture prête à être envoyée. -----------------------------------
+    if( SDL_AtomicGet( &mLoaderState ) == LOADER_DONE )
+    {
+        beginUpload();
+        return true;
+    }
+
+    if( mPending.empty() )
+    {
+        return false;
+    }
+
+    asset = mPending.front();
+
+    // --- Une texture à confier au fil de chargement. -------------------------
+    if( asset.type == ASSET_TEXTURE )
+    {
+        // Une texture à la fois: les suivantes attendent.
+        if( SDL_AtomicGet( &mLoaderState ) != LOADER_IDLE )
+        {
+            return false;
+        }
+
+        mPending.erase( mPending.begin() );
+        mLoadName = asset.name;
+        SDL_AtomicSet( &mLoaderState, LOADER_BUSY );
+
+        if( mLoader != NULL )
+        {
+            SDL_SemPost( mLoaderWake );
+        }
+
+        else
+        {
+            prepareTexture();
+            SDL_AtomicSet( &mLoaderState, LOADER_DONE );
+        }
+
+        return true;
+    }
+
+    // --- Un CMF ou une entité, en une étape. ---------------------------------
+    mPending.erase( mPending.begin() );
+    reload( asset );
+
+    return true;
+}
+
+//! @brief Procédure de rechargement d'un CMF ou d'une entité.
+//!
+//! Les textures passent par le fil de chargement: voir prepareTexture().
+//! @param asset La ressource modifiée.
+void cirion::AssetWatcher::reload( const PendingAsset& asset )
+{
+    CIRION_PROFILE_ZONE( "AssetWatcher::reload" );
+
+    /* Une ressource en cours d'édition peut être invalide: l'erreur est
+    reportée au journal sans interrompre le jeu. */
+    try
+    {
+        switch( asset.type )
+        {
+            // --- Map du monde. -----------------------------------------------
+            case ASSET_CMF:
+            if( asset.name == gWorld.getName() )
+            {
+                gWorld.create( asset.name.c_str() );
+            }
+
+            break;
+
+            // --- Entités. ----------------------------------------------------
+            case ASSET_ENTITY:
+            {
+                EntityPrototype* prototype = findPrototype( asset.name.c_str() );
+
+                // Recrée aussi les sprites de toutes les instances.
+                if( prototype != NULL )
+                {
+                    prototype->reload();
+                }
+            }
+
+            break;
+
+            default:
+            break;
+        }
+    }
+
+    catch( CiException const& e )
+    {
+        log( e );
+    }
+}
+
+//! @brief Procédure de lecture et de cuisson d'une texture modifiée.
+//!
+//! Exécutée par le fil de chargement: rien n'est envoyé au renderer. Les
+//! nouveaux pixels sont comparés au cache, puis écrits à côté du cache
+//! (.tmp); endUpload() le remplace une fois les textures à jour.
+void cirion::AssetWatcher::prepareTexture()
+{
+    CIRION_PROFILE_ZONE( "AssetWatcher::prepareTexture" );
+
+    ostringstream filepath;  //!< Le chemin du bitmap.
+    ostringstream cachepath; //!< Le chemin de la texture précuite.
+
+    filepath << gWorkingDir
+             << "/Textures/"
+             << mLoadName
+             << ".bmp";
+
+    cachepath << gWorkingDir
+              << "/Cache/"
+              << mLoadName
+              << ".ctx";
+
+    mLoadPreviousHash = 0;
+    mIsLoadCached     = false;
+    memset( &mLoadRect, 0x00, sizeof(SDL_Rect) );
+
+    /* Une ressource en cours d'édition peut être invalide: l'erreur est
+    reportée au journal sans interrompre le jeu. */
+    try
+    {
+        Surface surface; //!< La surface chargée avec le bitmap.
+
+        mLoadHash = CookedTexture::computeSourceHash( filepath.str().c_str() );
+        surface.create( filepath.str().c_str() );
+        mLoadCooked.cook( &surface, mLoadHash );
+    }
+
+    catch( CiException const& e )
+    {
+        log( e );
+        mLoadCooked.clear();
+        return;
+    }
+
+    // Sans cache, les textures sont toujours renvoyées entièrement.
+    if( !gConfig.mIsTextureCacheEnabled )
+    {
+        return;
+    }
+
+    // --- Comparaison avec les pixels du cache. -------------------------------
+    try
+    {
+        CookedTexture previous; //!< Les pixels actuellement en cache.
+
+        previous.load( cachepath.str().c_str() );
+
+        if( mLoadCooked.diff( previous, &mLoadRect ) )
+        {
+            mLoadPreviousHash = previous.getSourceHash();
+        }
+    }
+
+    catch( CiException const& e )
+    {
+        mLoadPreviousHash = 0;
+    }
+
+    // --- Ecriture du nouveau cache, à côté de l'ancien. ----------------------
+    try
+    {
+        mLoadCooked.write( ( cachepath.str() + ".tmp" ).c_str() );
+        mIsLoadCached = true;
+    }
+
+    catch( CiException const& e )
+    {
+        log( e );
+    }
+}
+
+//! @brief Procédure de début d'envoi de la texture préparée.
+//!
+//! Chaque texture du nom reçoit le rectangle modifié si ses pixels sont
+//! ceux du cache relu, la texture entière sinon; une texture redimensionnée
+//! est recréée.
+void cirion::AssetWatcher::beginUpload()
+{
+    vector<Texture*> textures;
+    SDL_Rect         full;
+
+    // Echec de la préparation, déjà reporté au journal.
+    if( mLoadCooked.getPixels() == NULL )
+    {
+        SDL_AtomicSet( &mLoaderState, LOADER_IDLE );
+        return;
+    }
+
+    full.x = 0;
+    full.y = 0;
+    full.w = mLoadCooked.getWidth();
+    full.h = mLoadCooked.getHeight();
+
+    mUploads.clear();
+    mUploadRow = full.h;
+    mUploadEnd = 0;
+    findTextures( textures );
+
+    for( size_t i = 0; i != textures.size(); i++ )
+    {
+        Texture*      texture = textures[i];
+        TextureUpload upload;
+
+        /* Une texture évincée sera recrée depuis le cache (ou le bitmap) à
+        jour lors de sa prochaine utilisation. */
+        if( texture->isEvicted() || texture->getSourceHash() == mLoadHash )
+        {
+            continue;
+        }
+
+        if(    texture->getWidth()  != full.w
+            || texture->getHeight() != full.h )
+        {
+            try
+            {
+                texture->create( &mLoadCooked );
+            }
+
+            catch( CiException const& e )
+            {
+                log( e );
+            }
+
+            continue;
+        }
+
+        upload.texture    = texture;
+        upload.sourceHash = texture->getSourceHash();
+        upload.rect       = mLoadPreviousHash != 0
+                         && upload.sourceHash == mLoadPreviousHash
+                          ? mLoadRect
+                          : full;
+
+        if( upload.rect.w == 0 )
+        {
+            texture->setSourceHash( mLoadHash );
+            continue;
+        }
+
+        mUploadRow = mUploadRow < upload.rect.y
+                   ? mUploadRow
+                   : upload.rect.y;
+        mUploadEnd = mUploadEnd > upload.rect.y + upload.rect.h
+                   ? mUploadEnd
+                   : upload.rect.y + upload.rect.h;
+        mUploads.push_back( upload );
+    }
+
+    if( mUploads.empty() )
+    {
+        endUpload();
+    }
+}
+
+//! @brief Procédure d'envoi de la bande de rangées suivante.
+//!
+//! Une texture modifiée depuis le début de l'envoi (monde rechargé, ...)
+//! est écartée: endUpload() la recrée.
+void cirion::AssetWatcher::uploadBand()
+{
+    int end = mUploadRow + ASSETWATCHER_UPLOAD_ROWS;
+
+    for( size_t i = 0; i != mUploads.size(); i++ )
+    {
+        TextureUpload& upload = mUploads[i];
+        SDL_Rect       band   = upload.rect;
+        int            bottom = upload.rect.y + upload.rect.h;
+
+        if(    upload.texture == NULL
+            || upload.texture->getSourceHash() != upload.sourceHash
+            || upload.texture->isEvicted() )
+        {
+            upload.texture = NULL;
+            continue;
+        }
+
+        band.y = mUploadRow > band.y ? mUploadRow : band.y;
+        band.h = ( end < bottom ? end : bottom ) - band.y;
+
+        if( band.h <= 0 )
+        {
+            continue;
+        }
+
+        try
+        {
+            upload.texture->update( &mLoadCooked, band );
+        }
+
+        catch( CiException const& e )
+        {
+            log( e );
+            upload.texture = NULL;
+        }
+    }
+
+    mUploadRow = end;
+
+    if( mUploadRow >= mUploadEnd )
+    {
+        endUpload();
+    }
+}
+
+//! @brief Procédure de fin d'envoi de la texture préparée.
+//!
+//! Le cache est remplacé pour refléter le contenu des textures; celles qui
+//! n'ont pas reçu les nouveaux pixels sont recréées entièrement.
+void cirion::AssetWatcher::endUpload()
+{
+    ostringstream    oss;
+    ostringstream    cachepath;
+    vector<Texture*> textures;
+
+    for( size_t i = 0; i != mUploads.size(); i++ )
+    {
+        if( mUploads[i].texture != NULL )
+        {
+            mUploads[i].texture->setSourceHash( mLoadHash );
+        }
+    }
+
+    // --- Remplacement du cache. ----------------------------------------------
+    if( mIsLoadCached )
+    {
+        cachepath << gWorkingDir
+                  << "/Cache/"
+                  << mLoadName
+                  << ".ctx";
+
+        #ifdef _WIN32
+            remove( cachepath.str().c_str() );
+        #endif
+
+        rename( ( cachepath.str() + ".tmp" ).c_str(), cachepath.str().c_str() );
+    }
+
+    // --- Recréation des textures restées en arrière. -------------------------
+    findTextures( textures );
+
+    for( size_t i = 0; i != textures.size(); i++ )
+    {
+        if(    !textures[i]->isEvicted()
+            && textures[i]->getSourceHash() != mLoadHash )
+        {
+            try
+            {
+                textures[i]->create( &mLoadCooked );
+            }
+
+            catch( CiException const& e )
+            {
+                log( e );
+            }
+        }
+    }
+
+    oss << "Texture \""
+        << mLoadName
+        << "\" reloaded: ";
+
+    if( mLoadPreviousHash == 0 )
+    {
+        oss << "fully re-uploaded.";
+    }
+
+    else if( mLoadRect.w == 0 )
+    {
+        oss << "no pixel changed.";
+    }
+
+    else
+    {
+        oss << mLoadRect.w << "x" << mLoadRect.h
+            << " px at (" << mLoadRect.x << ", " << mLoadRect.y
+            << ") re-uploaded.";
+    }
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+
+    mUploads.clear();
+    mLoadCooked.clear();
+    SDL_AtomicSet( &mLoaderState, LOADER_IDLE );
+}
+
+//! @brief Procédure de recherche des textures portant le nom chargé.
+//! @param textures Les textures du monde et des objets trouvées.
+void cirion::AssetWatcher::findTextures( vector<Texture*>& textures )
+{
+    gWorld.findTextures( mLoadName.c_str(), textures );
+
+    for( size_t i = 0; i != gTextures.size(); i++ )
+    {
+        if(    gTextures[i]->getName() != NULL
+            && mLoadName == gTextures[i]->getName() )
+        {
+            textures.push_back( gTextures[i] );
+        }
+    }
+}
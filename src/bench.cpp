@@ -0,0 +1,1357 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    bench.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Mesures de performance.
+ */
+
+#include <cmath>
+#include <cstdlib> // rand()
+#include <cstring>
+#include <ctime>   // clock()
+#include <sstream>
+#include <vector>
+#include <SDL2/SDL.h>
+#include <Cirion/animationsystem.hpp>
+#include <Cirion/bench.hpp>
+#include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/collisionsystem.hpp>
+#include <Cirion/framepacer.hpp>
+#include <Cirion/framestats.hpp>
+#include <Cirion/hiro.hpp>
+#include <Cirion/jobsystem.hpp>
+#include <Cirion/log.hpp>
+#include <Cirion/particlesystem.hpp>
+#include <Cirion/registry.hpp>
+#include <Cirion/sprite.hpp>
+#include <Cirion/texture.hpp>
+#include <Cirion/tilemap.hpp>
+#include <Cirion/world.hpp>
+
+using namespace std;
+using namespace cirion;
+
+//! @brief Procédure de mesure du chargement d'un niveau.
+//!
+//! Deux passes: à froid, le cache de textures est ignoré et chaque texture
+//! est recuite depuis son bitmap (surfaces et tampons de cuisson passent par
+//! la réserve de pixels); à chaud, les textures précuites sont projetées.
+//! Le moteur doit être initialisé.
+//! @param name Le nom du fichier CMF.
+//! @param iterations Le nombre de chargements par passe.
+//! @throw CiException en cas d'échec.
+void cirion::benchLevelLoad( const char* name, int iterations )
+{
+    bool isCacheEnabled = gConfig.mIsTextureCacheEnabled;
+
+    for( int pass = 0; pass != 2; pass++ )
+    {
+        ostringstream oss;
+        Uint64        frequency = SDL_GetPerformanceFrequency();
+        Uint64        total     = 0;
+        Uint64        min       = 0;
+        Uint64        max       = 0;
+        unsigned int  hits      = gStats.pixelPoolHits;
+        unsigned int  misses    = gStats.pixelPoolMisses;
+
+        gConfig.mIsTextureCacheEnabled = pass == 1;
+
+        for( int i = 0; i != iterations; i++ )
+        {
+            Uint64 start = SDL_GetPerformanceCounter();
+            Uint64 elapsed;
+
+            try
+            {
+                gWorld.create( name );
+            }
+
+            catch( CiException const& e )
+            {
+                gConfig.mIsTextureCacheEnabled = isCacheEnabled;
+                throw;
+            }
+
+            elapsed = SDL_GetPerformanceCounter() - start;
+            total  += elapsed;
+            min     = ( i == 0 || elapsed < min ) ? elapsed : min;
+            max     = elapsed > max ? elapsed : max;
+        }
+
+        oss << "Level \""
+            << name
+            << "\" loaded "
+            << iterations
+            << " time(s) "
+            << ( pass == 0 ? "cold (texture cache bypassed)" : "warm" )
+            << ": min "
+            << min * 1000000 / frequency
+            << " us, avg "
+            << ( iterations != 0 ? total * 1000000 / frequency / iterations : 0 )
+            << " us, max "
+            << max * 1000000 / frequency
+            << " us; pixel pool: "
+            << gStats.pixelPoolHits - hits
+            << " hit(s), "
+            << gStats.pixelPoolMisses - misses
+            << " miss(es).";
+
+        log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    gConfig.mIsTextureCacheEnabled = isCacheEnabled;
+}
+
+//! @brief Procédure de mesure de l'avancement groupé des animations.
+//!
+//! Les sprites partagent des données synthétiques (deux animations de huit
+//! images de 60 à 130 ms) et sont désynchronisés, comme dans un niveau. Le
+//! moteur n'a pas besoin d'être initialisé.
+//! @param count Le nombre de sprites animés.
+//! @param ticks Le nombre de mises à jour de 16 ms.
+void cirion::benchAnimations( int count, int ticks )
+{
+    ostringstream   oss;
+    AnimationSystem system;
+    SpriteData      data;
+    Uint64          frequency = SDL_GetPerformanceFrequency();
+    Uint64          total     = 0;
+    Uint64          min       = 0;
+    Uint64          max       = 0;
+
+    memset( data.name,        0x00, sizeof(data.name) );
+    memset( data.spritesheet, 0x00, sizeof(data.spritesheet) );
+    data.srcW             = 32;
+    data.srcH             = 32;
+    data.hitbox.x         = 0;
+    data.hitbox.y         = 0;
+    data.hitbox.w         = 32;
+    data.hitbox.h         = 32;
+    data.initialAnimation = 0;
+    data.animations.resize( 2 );
+
+    for( size_t i = 0; i != data.animations.size(); i++ )
+    {
+        data.animations[i].name[0] = '\0';
+        data.animations[i].frames.resize( 8 );
+
+        for( size_t j = 0; j != data.animations[i].frames.size(); j++ )
+        {
+            Frame& frame = data.animations[i].frames[j];
+
+            frame.left        = Point2i( (int)j * 32, (int)i * 64 );
+            frame.right       = Point2i( (int)j * 32, (int)i * 64 + 32 );
+            frame.leftTrim.x  = 4;
+            frame.leftTrim.y  = 2;
+            frame.leftTrim.w  = 24;
+            frame.leftTrim.h  = 30;
+            frame.rightTrim   = frame.leftTrim;
+            frame.duration    = 60 + (int)( ( i * 8 + j ) * 5 );
+        }
+    }
+
+    for( int i = 0; i != count; i++ )
+    {
+        int handle = system.add( &data );
+
+        system.setAnimation( handle, i % 2 );
+        system.setFacingRight( handle, ( i / 2 ) % 2 == 0 );
+        // Désynchronisation des animations
+        system.update( i % 7 );
+    }
+
+    for( int i = 0; i != ticks; i++ )
+    {
+        Uint64 start = SDL_GetPerformanceCounter();
+        Uint64 elapsed;
+
+        system.update( 16 );
+
+        elapsed = SDL_GetPerformanceCounter() - start;
+        total  += elapsed;
+        min     = ( i == 0 || elapsed < min ) ? elapsed : min;
+        max     = elapsed > max ? elapsed : max;
+    }
+
+    oss << count
+        << " sprite(s) animated over "
+        << ticks
+        << " tick(s): min "
+        << min * 1000000 / frequency
+        << " us, avg "
+        << ( ticks != 0 ? total * 1000000 / frequency / ticks : 0 )
+        << " us, max "
+        << max * 1000000 / frequency
+        << " us per tick; "
+        << ( ticks != 0 && count != 0
+             ? total * 1000000000 / frequency / ticks / count
+             : 0 )
+        << " ns per sprite, "
+        << count * AnimationSystem::getSlotSize() / 1024
+        << " KiB of animation state.";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
+
+//! @brief Procédure de mesure de la détection des collisions.
+//!
+//! Des corps de 16x16 pixels rebondissent dans un monde dont la surface
+//! croît avec leur nombre (densité constante, un corps pour 64x64 pixels en
+//! moyenne). Le moteur n'a pas besoin d'être initialisé.
+//! @param count Le nombre de corps.
+//! @param ticks Le nombre de mises à jour.
+void cirion::benchCollisions( int count, int ticks )
+{
+    ostringstream   oss;
+    CollisionSystem system;
+    SDL_Rect        hitbox;
+    vector<Point2f> positions( count );
+    vector<Point2f> velocities( count );
+    float           size      = 64.0f * sqrt( (float)count );
+    Uint32          seed      = 0x2545F491;
+    Uint64          frequency = SDL_GetPerformanceFrequency();
+    Uint64          total     = 0;
+    Uint64          min       = 0;
+    Uint64          max       = 0;
+    Uint64          contacts  = 0;
+
+    hitbox.x = 0;
+    hitbox.y = 0;
+    hitbox.w = 16;
+    hitbox.h = 16;
+
+    for( int i = 0; i != count; i++ )
+    {
+        // Générateur congruentiel: la mesure est reproductible.
+        seed = seed * 1664525 + 1013904223;
+        positions[i].mX  = (float)( seed >> 8 ) / (float)( 1 << 24 ) * size;
+        seed = seed * 1664525 + 1013904223;
+        positions[i].mY  = (float)( seed >> 8 ) / (float)( 1 << 24 ) * size;
+        seed = seed * 1664525 + 1013904223;
+        velocities[i].mX = (float)( (int)( seed >> 29 ) - 4 ) * 0.5f;
+        seed = seed * 1664525 + 1013904223;
+        velocities[i].mY = (float)( (int)( seed >> 29 ) - 4 ) * 0.5f;
+
+        system.setPosition( system.add( NULL, hitbox ), positions[i] );
+    }
+
+    for( int tick = 0; tick != ticks; tick++ )
+    {
+        Uint64 start;
+        Uint64 elapsed;
+
+        for( int i = 0; i != count; i++ )
+        {
+            positions[i] += velocities[i];
+
+            if( positions[i].mX < 0.0f || positions[i].mX > size )
+            {
+                velocities[i].mX = -velocities[i].mX;
+            }
+
+            if( positions[i].mY < 0.0f || positions[i].mY > size )
+            {
+                velocities[i].mY = -velocities[i].mY;
+            }
+
+            system.setPosition( i, positions[i] );
+        }
+
+        start = SDL_GetPerformanceCounter();
+
+        system.update();
+
+        elapsed   = SDL_GetPerformanceCounter() - start;
+        total    += elapsed;
+        min       = ( tick == 0 || elapsed < min ) ? elapsed : min;
+        max       = elapsed > max ? elapsed : max;
+        contacts += system.getContacts().size();
+    }
+
+    oss << count
+        << " moving bod(y/ies) over "
+        << ticks
+        << " tick(s): min "
+        << min * 1000000 / frequency
+        << " us, avg "
+        << ( ticks != 0 ? total * 1000000 / frequency / ticks : 0 )
+        << " us, max "
+        << max * 1000000 / frequency
+        << " us per tick; "
+        << ( ticks != 0 ? contacts / ticks : 0 )
+        << " contact(s) per tick, "
+        << ( total != 0 ? contacts * frequency / total : 0 )
+        << " pairs/s"
+        #ifdef __SSE2__
+        << " (SSE2).";
+        #else
+        << " (scalar).";
+        #endif
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
+
+/**
+ * Une structure pour décrire un cas de déplacement contre la grille.
+ */
+typedef struct
+{
+    const char* name;
+    float x, y;     // Position de départ
+    float dx, dy;   // Déplacement
+    bool grounded;  // Boîte au sol au départ
+    float ex, ey;   // Position attendue
+    Uint32 contacts;
+} TileCase;
+
+//! @brief Procédure de mesure des déplacements contre la grille de tuiles.
+//!
+//! Une grille synthétique de 256x64 tuiles est construite: sols percés,
+//! murets, plateformes et pentes. Des cas déterministes sont vérifiés
+//! d'abord, puis des corps de 8x8 pixels soumis à la gravité courent et
+//! sautent. Le moteur n'a pas besoin d'être initialisé.
+//! @param count Le nombre de corps.
+//! @param ticks Le nombre de mises à jour de 16 ms.
+//! @throw CiException si un cas déterministe échoue.
+void cirion::benchTiles( int count, int ticks )
+{
+    // Tuiles de la grille synthétique.
+    enum { EMPTY, SOLID, ONEWAY, SLOPE_UP, SLOPE_DOWN };
+
+    static const TileCase cases[] =
+    {
+        // Nom, départ, déplacement, au sol, arrivée, contacts.
+        { "fall onto floor",    16,  0,   0, 200, false,  16,  56,
+          TILE_CONTACT_GROUND },
+        { "wall on the right",  100, 56,  50,   1, true,  120,  56,
+          TILE_CONTACT_WALL | TILE_CONTACT_GROUND },
+        { "wall on the left",   150, 56, -50,   1, true,  144,  56,
+          TILE_CONTACT_WALL | TILE_CONTACT_GROUND },
+        { "one-way from below", 56,  50,   0, -30, false, 56,  20, 0 },
+        { "one-way from above", 56,   0,   0,  20, false, 56,   8,
+          TILE_CONTACT_GROUND },
+        { "resting on floor",   16,  56,   0,   0, true,  16,  56,
+          TILE_CONTACT_GROUND },
+        { "resting on one-way", 56,   8,   0,   0, true,  56,   8,
+          TILE_CONTACT_GROUND },
+        { "up the slope",       176, 56,  16,   1, true,  192, 52,
+          TILE_CONTACT_GROUND },
+        { "down the slope",     212, 48,   4,   1, true,  216, 52,
+          TILE_CONTACT_GROUND },
+        { "ceiling",            160, 40,   0, -60, false, 160, 16,
+          TILE_CONTACT_CEILING }
+    };
+
+    ostringstream oss;
+    TileMap       map;
+    Arena         arena;
+    TileFlags     flags;
+    SDL_Rect      box;
+    vector<Uint8> tiles;
+    Uint32        seed      = 0x2545F491;
+    Uint64        frequency = SDL_GetPerformanceFrequency();
+    Uint64        total     = 0;
+    Uint64        min       = 0;
+    Uint64        max       = 0;
+    int           width     = 256;
+    int           height    = 64;
+
+    flags.left = 0; flags.right = 0;
+    flags.type = TILE_EMPTY;  map.setFlags( EMPTY,  flags );
+    flags.type = TILE_SOLID;  map.setFlags( SOLID,  flags );
+    flags.type = TILE_ONEWAY; map.setFlags( ONEWAY, flags );
+    flags.type = TILE_SLOPE;  flags.right = TILE_H;
+    map.setFlags( SLOPE_UP, flags );
+    flags.left = TILE_H; flags.right = 0;
+    map.setFlags( SLOPE_DOWN, flags );
+
+    box.x = 0; box.y = 0; box.w = 8; box.h = 8;
+
+    // --- Cas déterministes, sur une grille de 16x5 tuiles. -------------------
+    /*  ..........#.....    # plafond
+        ...===..........    = plateforme à sens unique
+        ................
+        ........#.../\..    / pente montante, \ descendante
+        ################ */
+    tiles.assign( 16 * 5, EMPTY );
+
+    for( int x = 0; x != 16; x++ )
+    {
+        tiles[4 * 16 + x] = SOLID;
+    }
+
+    tiles[1 * 16 + 3]  = ONEWAY;
+    tiles[1 * 16 + 4]  = ONEWAY;
+    tiles[1 * 16 + 5]  = ONEWAY;
+    tiles[0 * 16 + 10] = SOLID;
+    tiles[3 * 16 + 8]  = SOLID;
+    tiles[3 * 16 + 12] = SLOPE_UP;
+    tiles[3 * 16 + 13] = SLOPE_DOWN;
+    map.build( 16, 5, &tiles[0], arena );
+
+    for( size_t i = 0; i != sizeof(cases) / sizeof(TileCase); i++ )
+    {
+        Point2f position( cases[i].x, cases[i].y );
+        Uint32  contacts = map.move( position, box,
+                                     Point2f( cases[i].dx, cases[i].dy ),
+                                     cases[i].grounded );
+
+        if(    position.mX != cases[i].ex || position.mY != cases[i].ey
+            || contacts != cases[i].contacts )
+        {
+            oss << "Tile case \""
+                << cases[i].name
+                << "\" failed: got ("
+                << position.mX
+                << ", "
+                << position.mY
+                << ") contacts "
+                << contacts
+                << ", expected ("
+                << cases[i].ex
+                << ", "
+                << cases[i].ey
+                << ") contacts "
+                << cases[i].contacts
+                << ".";
+
+            throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+        }
+    }
+
+    oss << sizeof(cases) / sizeof(TileCase) << " tile case(s) passed." << endl;
+
+    // --- Grille de mesure. ---------------------------------------------------
+    tiles.assign( width * height, EMPTY );
+
+    for( int y = 7; y < height; y += 8 )
+    {
+        for( int x = 0; x != width; x++ )
+        {
+            seed = seed * 1664525 + 1013904223;
+
+            // Sols percés de trous, murets, pentes et plateformes.
+            switch( ( seed >> 24 ) % 16 )
+            {
+                case 0:  break;
+                case 1:  tiles[( y - 1 ) * width + x] = SOLID;      // muret
+                         tiles[y * width + x]         = SOLID;      break;
+                case 2:  tiles[( y - 1 ) * width + x] = SLOPE_UP;
+                         tiles[y * width + x]         = SOLID;      break;
+                case 3:  tiles[( y - 1 ) * width + x] = SLOPE_DOWN;
+                         tiles[y * width + x]         = SOLID;      break;
+                case 4:  tiles[( y - 4 ) * width + x] = ONEWAY;
+                         tiles[y * width + x]         = SOLID;      break;
+                default: tiles[y * width + x]         = SOLID;      break;
+            }
+        }
+    }
+
+    arena.reset();
+    map.build( width, height, &tiles[0], arena );
+
+    vector<Point2f> positions( count );
+    vector<Point2f> velocities( count );
+    vector<Uint8>   grounded( count, 0 );
+
+    for( int i = 0; i != count; i++ )
+    {
+        seed = seed * 1664525 + 1013904223;
+        positions[i].mX  = (float)( ( seed >> 8 ) % ( ( width - 2 ) * TILE_W ) + TILE_W );
+        seed = seed * 1664525 + 1013904223;
+        positions[i].mY  = (float)( ( seed >> 8 ) % ( height / 8 ) * 8 * TILE_H );
+        velocities[i].mX = ( i % 2 == 0 ? 1.0f : -1.0f ) * ( 0.05f + ( i % 5 ) * 0.01f );
+        velocities[i].mY = 0.0f;
+    }
+
+    for( int tick = 0; tick != ticks; tick++ )
+    {
+        Uint64 start = SDL_GetPerformanceCounter();
+        Uint64 elapsed;
+
+        for( int i = 0; i != count; i++ )
+        {
+            Uint32 contacts;
+
+            velocities[i].mY += 0.0008f * 16;
+            velocities[i].mY  = velocities[i].mY > 0.4f ? 0.4f : velocities[i].mY;
+
+            contacts = map.move( positions[i], box,
+                                 Point2f( velocities[i].mX * 16,
+                                          velocities[i].mY * 16 ),
+                                 grounded[i] != 0 );
+
+            if( contacts & TILE_CONTACT_WALL )
+            {
+                velocities[i].mX = -velocities[i].mX;
+            }
+
+            if( contacts & ( TILE_CONTACT_GROUND | TILE_CONTACT_CEILING ) )
+            {
+                velocities[i].mY = 0.0f;
+            }
+
+            grounded[i] = ( contacts & TILE_CONTACT_GROUND ) != 0;
+
+            // Saut de temps en temps.
+            if( grounded[i] && ( tick + i ) % 97 == 0 )
+            {
+                velocities[i].mY = -0.3f;
+            }
+        }
+
+        elapsed = SDL_GetPerformanceCounter() - start;
+        total  += elapsed;
+        min     = ( tick == 0 || elapsed < min ) ? elapsed : min;
+        max     = elapsed > max ? elapsed : max;
+    }
+
+    oss << count
+        << " bodies moved against a "
+        << width
+        << "x"
+        << height
+        << " tile grid over "
+        << ticks
+        << " tick(s): min "
+        << min * 1000000 / frequency
+        << " us, avg "
+        << ( ticks != 0 ? total * 1000000 / frequency / ticks : 0 )
+        << " us, max "
+        << max * 1000000 / frequency
+        << " us per tick; "
+        << ( ticks != 0 && count != 0
+             ? total * 1000000000 / frequency / ticks / count
+             : 0 )
+        << " ns per body.";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
+
+/**
+ * @class LegacyObject
+ *
+ * L'ancienne disposition de GameObject, reproduite pour la mesure: un objet
+ * alloué à part, avec ses données et des méthodes virtuelles.
+ */
+class LegacyObject
+{
+    public:
+    LegacyObject( const Point2f& position, const Point2f& velocity,
+                  Texture* texture ):
+        mPosition( position ),
+        mVelocity( velocity ),
+        mTexture ( texture ),
+        mOffset  ( Point2i( 0, 0 ) )
+    {
+        mSrc.x  = 0;
+        mSrc.y  = 0;
+        mSrc.w  = 16;
+        mSrc.h  = 16;
+        mDest   = mSrc;
+    }
+
+    virtual ~LegacyObject()
+    {
+    }
+
+    virtual void update( float timeStep )
+    {
+        mPosition.mX += mVelocity.mX * timeStep;
+        mPosition.mY += mVelocity.mY * timeStep;
+    }
+
+    virtual void draw( const Point2f& origin, vector<DrawCommand>& drawList )
+    {
+        mDest.x = (int)( mPosition.mX - origin.mX ) + mOffset.mX;
+        mDest.y = (int)( mPosition.mY - origin.mY ) + mOffset.mY;
+
+        if(    mTexture != NULL
+            && mDest.x < gRendererWidth
+            && mDest.y < gRendererHeight
+            && mDest.x + mDest.w > 0
+            && mDest.y + mDest.h > 0 )
+        {
+            DrawCommand command;
+
+            command.texture = mTexture;
+            command.src     = mSrc;
+            command.dest    = mDest;
+            drawList.push_back( command );
+        }
+    }
+
+    private:
+    Point2f  mPosition;
+    Point2f  mVelocity;
+    Texture* mTexture;
+    SDL_Rect mSrc;
+    SDL_Rect mDest;
+    Point2i  mOffset;
+};
+
+//! @brief Procédure de mesure de la mise à jour et du dessin des objets.
+//!
+//! Deux passes sur les mêmes objets de 16x16 pixels, répartis sur quatre
+//! écrans de côté et animés d'une vitesse constante: les objets alloués à
+//! part et leurs méthodes virtuelles, puis les composants du registre et
+//! ses systèmes. Le dessin s'arrête à la liste des images visibles, sans
+//! renderer. Le moteur n'a pas besoin d'être initialisé.
+//! @param count Le nombre d'objets.
+//! @param ticks Le nombre de mises à jour de 16 ms.
+void cirion::benchObjects( int count, int ticks )
+{
+    ostringstream         oss;
+    Texture               texture;
+    Registry              registry;
+    vector<LegacyObject*> objects;
+    vector<DrawCommand>   drawList;
+    vector<Point2f>       positions( count );
+    vector<Point2f>       velocities( count );
+    Point2f               origin( 0.0f, 0.0f );
+    Uint32                seed      = 0x2545F491;
+    Uint64                frequency = SDL_GetPerformanceFrequency();
+    Uint64                totals[2] = { 0, 0 };
+    size_t                visible   = 0;
+
+    for( int i = 0; i != count; i++ )
+    {
+        seed = seed * 1664525 + 1013904223;
+        positions[i].mX  = (float)( seed >> 8 ) / (float)( 1 << 24 )
+                         * 4 * gRendererWidth - 1.5f * gRendererWidth;
+        seed = seed * 1664525 + 1013904223;
+        positions[i].mY  = (float)( seed >> 8 ) / (float)( 1 << 24 )
+                         * 4 * gRendererHeight - 1.5f * gRendererHeight;
+        seed = seed * 1664525 + 1013904223;
+        velocities[i].mX = (float)( (int)( seed >> 29 ) - 4 ) * 0.01f;
+        seed = seed * 1664525 + 1013904223;
+        velocities[i].mY = (float)( (int)( seed >> 29 ) - 4 ) * 0.01f;
+    }
+
+    // --- Objets alloués à part. ----------------------------------------------
+    objects.reserve( count );
+
+    for( int i = 0; i != count; i++ )
+    {
+        objects.push_back( new LegacyObject( positions[i], velocities[i],
+                                             &texture ) );
+    }
+
+    for( int tick = 0; tick != ticks; tick++ )
+    {
+        Uint64 start = SDL_GetPerformanceCounter();
+
+        for( size_t i = 0; i != objects.size(); i++ )
+        {
+            objects[i]->update( 16 );
+        }
+
+        drawList.clear();
+
+        for( size_t i = 0; i != objects.size(); i++ )
+        {
+            objects[i]->draw( origin, drawList );
+        }
+
+        totals[0] += SDL_GetPerformanceCounter() - start;
+        visible   += drawList.size();
+    }
+
+    for( size_t i = 0; i != objects.size(); i++ )
+    {
+        delete objects[i];
+    }
+
+    oss << count
+        << " object(s) over "
+        << ticks
+        << " tick(s): "
+        << ( ticks != 0 ? totals[0] * 1000000 / frequency / ticks : 0 )
+        << " us per tick with virtual objects ("
+        << ( ticks != 0 ? visible / ticks : 0 )
+        << " visible), ";
+
+    // --- Composants du registre. ---------------------------------------------
+    visible = 0;
+
+    for( int i = 0; i != count; i++ )
+    {
+        ObjectId   id = registry.create();
+        Transform  transform;
+        Velocity   velocity;
+        Renderable renderable;
+
+        transform.position  = positions[i];
+        transform.previous  = positions[i];
+        velocity.velocity   = velocities[i];
+        renderable.texture  = &texture;
+        renderable.src.x    = 0;
+        renderable.src.y    = 0;
+        renderable.src.w    = 16;
+        renderable.src.h    = 16;
+        renderable.offset   = Point2i( 0, 0 );
+        renderable.order    = registry.getNextOrder();
+
+        registry.getTransforms().add( id, transform );
+        registry.getVelocities().add( id, velocity );
+        registry.getRenderables().add( id, renderable );
+    }
+
+    for( int tick = 0; tick != ticks; tick++ )
+    {
+        Uint64 start = SDL_GetPerformanceCounter();
+
+        registry.updateMotion( 16 );
+        registry.updateAttachments();
+        registry.updateRenderables();
+        visible   += registry.cull( origin );
+        totals[1] += SDL_GetPerformanceCounter() - start;
+    }
+
+    oss << ( ticks != 0 ? totals[1] * 1000000 / frequency / ticks : 0 )
+        << " us per tick with components ("
+        << ( ticks != 0 ? visible / ticks : 0 )
+        << " visible); "
+        << ( ticks != 0 && count != 0
+             ? totals[0] * 1000000000 / frequency / ticks / count
+             : 0 )
+        << " vs "
+        << ( ticks != 0 && count != 0
+             ? totals[1] * 1000000000 / frequency / ticks / count
+             : 0 )
+        << " ns per object.";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
+
+//! @brief Procédure de mesure des créations / destructions d'objets.
+//!
+//! Un dixième des sprites est détruit et recréé à chaque mise à jour, et un
+//! niveau synthétique de 256x64 tuiles est reconstruit dans son arène toutes
+//! les 60 mises à jour. Les allocations sur le tas (blocs des réserves et
+//! des arènes) sont comptées pendant la première seconde, puis en régime
+//! établi où elles doivent être nulles. Le moteur n'a pas besoin d'être
+//! initialisé.
+//! @param count Le nombre de sprites.
+//! @param ticks Le nombre de mises à jour, au delà de la première seconde.
+void cirion::benchSpawn( int count, int ticks )
+{
+    ostringstream   oss;
+    Arena           arena;
+    TileMap         map;
+    vector<Sprite*> sprites( count, (Sprite*)NULL );
+    vector<Uint8>   tiles( 256 * 64, 0 );
+    Uint32          seed      = 0x2545F491;
+    Uint64          frequency = SDL_GetPerformanceFrequency();
+    Uint64          total     = 0;
+    unsigned int    heap[2]   = { 0, 0 };
+    int             churn     = count / 10 > 0 ? count / 10 : 1;
+    int             warmup    = 60;
+
+    for( size_t i = 0; i != tiles.size(); i++ )
+    {
+        seed     = seed * 1664525 + 1013904223;
+        tiles[i] = ( seed >> 24 ) % 4 == 0 ? 1 : 0;
+    }
+
+    heap[0] = gStats.objectPoolMisses + gStats.arenaChunks;
+
+    for( int i = 0; i != count; i++ )
+    {
+        sprites[i] = new Sprite();
+    }
+
+    heap[0] = gStats.objectPoolMisses + gStats.arenaChunks - heap[0];
+
+    for( int tick = 0; tick != warmup + ticks; tick++ )
+    {
+        unsigned int allocations = gStats.objectPoolMisses + gStats.arenaChunks;
+        Uint64       start       = SDL_GetPerformanceCounter();
+
+        for( int i = 0; i != churn; i++ )
+        {
+            int index;
+
+            seed  = seed * 1664525 + 1013904223;
+            index = (int)( ( seed >> 8 ) % count );
+
+            delete sprites[index];
+            sprites[index] = new Sprite();
+            sprites[index]->setPosition( Point2f( (float)i, (float)tick ) );
+        }
+
+        if( tick % 60 == 0 )
+        {
+            arena.reset();
+            map.build( 256, 64, &tiles[0], arena );
+        }
+
+        if( tick >= warmup )
+        {
+            total += SDL_GetPerformanceCounter() - start;
+        }
+
+        heap[tick >= warmup] += gStats.objectPoolMisses + gStats.arenaChunks
+                              - allocations;
+    }
+
+    for( int i = 0; i != count; i++ )
+    {
+        delete sprites[i];
+    }
+
+    oss << count
+        << " sprite(s), "
+        << churn
+        << " respawned per tick: "
+        << heap[0]
+        << " heap block(s) during warm-up, "
+        << heap[1]
+        << " over "
+        << ticks
+        << " steady tick(s); "
+        << ( ticks != 0 ? total * 1000000000 / frequency / ticks / churn : 0 )
+        << " ns per despawn + spawn, "
+        << arena.getReservedSize() / 1024
+        << " KiB level arena, "
+        << gSpritePool.getReservedSize() / 1024
+        << " KiB sprite pool.";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
+
+/**
+ * Une bulle telle qu'animée avant le système de particules: un objet
+ * alloué à part, une méthode virtuelle, rand() et deux divisions par bulle.
+ */
+class LegacyBubble
+{
+    public:
+    LegacyBubble()
+    {
+        regen( true );
+    }
+
+    virtual ~LegacyBubble()
+    {
+    }
+
+    virtual void update( float timeStep )
+    {
+        mZ -= 0.075 * timeStep / 20;
+
+        if( mZ <= 0 )
+        {
+            regen( false );
+        }
+
+        mSrc.x  = (int)mZ * 16;
+        mSrc.y  = 0;
+        mSrc.w  = 16;
+        mSrc.h  = 16;
+        mDest.x = (int)( gRendererWidth  / 2 + mX / mZ - 8 );
+        mDest.y = (int)( gRendererHeight / 2 + mY / mZ - 8 );
+        mDest.w = 16;
+        mDest.h = 16;
+    }
+
+    virtual void draw( vector<DrawCommand>& drawList )
+    {
+        // Les images au delà de la texture (128 pixels) sont transparentes.
+        if(    mSrc.x < 128
+            && mDest.x < gRendererWidth
+            && mDest.y < gRendererHeight
+            && mDest.x + mDest.w > 0
+            && mDest.y + mDest.h > 0 )
+        {
+            DrawCommand command;
+
+            command.texture = NULL;
+            command.src     = mSrc;
+            command.dest    = mDest;
+            drawList.push_back( command );
+        }
+    }
+
+    private:
+    void regen( bool randomDepth )
+    {
+        mZ = randomDepth ? (float)( rand() % 80 ) / 10 + 8 : 8;
+        mX = rand() % ( 8 * gRendererWidth  ) - ( 8 * 160 );
+        mY = rand() % ( 8 * gRendererHeight ) - ( 8 * 120 );
+    }
+
+    float    mX;
+    float    mY;
+    float    mZ;
+    SDL_Rect mSrc;
+    SDL_Rect mDest;
+};
+
+//! @brief Procédure de mesure du champ de bulles.
+//!
+//! Deux passes sur le même champ (description de Data/Emitters/Bubbles.xml,
+//! texture de huit images): les bulles objets, puis un émetteur du système
+//! de particules. Une passe comprend la mise à jour et la préparation du
+//! dessin (liste des images visibles, ou sommets des lots), sans renderer.
+//! Le moteur n'a pas besoin d'être initialisé.
+//! @param count Le nombre de particules.
+//! @param ticks Le nombre de mises à jour de 16 ms.
+void cirion::benchParticles( int count, int ticks )
+{
+    ostringstream         oss;
+    ParticleSystem        system;
+    EmitterConfig         config;
+    vector<LegacyBubble*> bubbles;
+    vector<DrawCommand>   drawList;
+    Uint64                frequency = SDL_GetPerformanceFrequency();
+    Uint64                totals[2] = { 0, 0 };
+    Uint64                max       = 0;
+    size_t                visible   = 0;
+
+    // --- Bulles objets. ------------------------------------------------------
+    srand( 0x2545F491 );
+    bubbles.reserve( count );
+
+    for( int i = 0; i != count; i++ )
+    {
+        bubbles.push_back( new LegacyBubble() );
+    }
+
+    for( int tick = 0; tick != ticks; tick++ )
+    {
+        Uint64 start = SDL_GetPerformanceCounter();
+
+        for( size_t i = 0; i != bubbles.size(); i++ )
+        {
+            bubbles[i]->update( 16 );
+        }
+
+        drawList.clear();
+
+        for( size_t i = 0; i != bubbles.size(); i++ )
+        {
+            bubbles[i]->draw( drawList );
+        }
+
+        totals[0] += SDL_GetPerformanceCounter() - start;
+        visible   += drawList.size();
+    }
+
+    for( size_t i = 0; i != bubbles.size(); i++ )
+    {
+        delete bubbles[i];
+    }
+
+    oss << count
+        << " particle(s) over "
+        << ticks
+        << " tick(s): "
+        << ( ticks != 0 ? totals[0] * 1000000 / frequency / ticks : 0 )
+        << " us per tick with bubble objects ("
+        << ( ticks != 0 ? visible / ticks : 0 )
+        << " visible), ";
+
+    // --- Émetteur. -----------------------------------------------------------
+    config.texture     = "TexBubble";
+    config.count       = count;
+    config.frameWidth  = 16;
+    config.frameHeight = 16;
+    config.frames      = 8;
+    config.spreadX     = 8.0f * gRendererWidth;
+    config.spreadY     = 8.0f * gRendererHeight;
+    config.depthMin    = 8.0f;
+    config.depthMax    = 16.0f;
+    config.depthReset  = 8.0f;
+    config.speed       = 0.075f / 20;
+    visible            = 0;
+
+    system.add( config, NULL );
+
+    for( int tick = 0; tick != ticks; tick++ )
+    {
+        Uint64 start = SDL_GetPerformanceCounter();
+        Uint64 elapsed;
+
+        system.update( 16 );
+        visible   += system.prepare();
+        elapsed    = SDL_GetPerformanceCounter() - start;
+        totals[1] += elapsed;
+        max        = elapsed > max ? elapsed : max;
+    }
+
+    oss << ( ticks != 0 ? totals[1] * 1000000 / frequency / ticks : 0 )
+        << " us (max "
+        << max * 1000000 / frequency
+        << " us) per tick with an emitter ("
+        << ( ticks != 0 ? visible / ticks : 0 )
+        << " visible, "
+        << system.getBatchCount()
+        << " batch(es)); "
+        << ( ticks != 0 && count != 0
+             ? totals[0] / ticks * 1000000000 / frequency / count
+             : 0 )
+        << " vs "
+        << ( ticks != 0 && count != 0
+             ? totals[1] / ticks * 1000000000 / frequency / count
+             : 0 )
+        << " ns per particle"
+        #ifdef __SSE2__
+        << " (SSE2).";
+        #else
+        << " (scalar).";
+        #endif
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
+
+//! @brief Procédure de mesure de la répartition des mises à jour.
+//!
+//! Un émetteur de particules et autant d'objets mobiles du registre sont
+//! mis à jour avec 1, 2, 4, 8 et 16 fils. Une empreinte des positions
+//! projetées et des objets est comparée à celle d'un seul fil: elle doit
+//! être identique. Le moteur n'a pas besoin d'être initialisé.
+//! @param count Le nombre de particules, et d'objets.
+//! @param ticks Le nombre de mises à jour de 16 ms.
+void cirion::benchJobs( int count, int ticks )
+{
+    static const int threadCounts[] = { 1, 2, 4, 8, 16 };
+
+    EmitterConfig config;
+    Uint64        frequency = SDL_GetPerformanceFrequency();
+    Uint64        reference = 0;
+    Uint32        expected  = 0;
+
+    config.texture     = "TexBubble";
+    config.count       = count;
+    config.frameWidth  = 16;
+    config.frameHeight = 16;
+    config.frames      = 8;
+    config.spreadX     = 8.0f * gRendererWidth;
+    config.spreadY     = 8.0f * gRendererHeight;
+    config.depthMin    = 8.0f;
+    config.depthMax    = 16.0f;
+    config.depthReset  = 8.0f;
+    config.speed       = 0.075f / 20;
+
+    for( size_t pass = 0; pass != sizeof(threadCounts) / sizeof(int); pass++ )
+    {
+        ostringstream    oss;
+        ParticleSystem   system;
+        Registry         registry;
+        ParticleEmitter* emitter;
+        Uint32           seed  = 0x2545F491;
+        Uint32           hash  = 2166136261u;
+        Uint64           total = 0;
+        size_t           visible;
+
+        gJobSystem.start( threadCounts[pass] );
+        emitter = system.add( config, NULL );
+
+        for( int i = 0; i != count; i++ )
+        {
+            ObjectId  id = registry.create();
+            Transform transform;
+            Velocity  velocity;
+
+            seed = seed * 1664525 + 1013904223;
+            transform.position  = Point2f( (float)( seed >> 20 ), 0.0f );
+            transform.previous  = transform.position;
+            seed = seed * 1664525 + 1013904223;
+            velocity.velocity   = Point2f( (float)( (int)( seed >> 29 ) - 4 ) * 0.01f,
+                                           0.05f );
+
+            registry.getTransforms().add( id, transform );
+            registry.getVelocities().add( id, velocity );
+        }
+
+        for( int tick = 0; tick != ticks; tick++ )
+        {
+            Uint64 start = SDL_GetPerformanceCounter();
+
+            system.update( 16 );
+            registry.updateMotion( 16 );
+            total += SDL_GetPerformanceCounter() - start;
+        }
+
+        // Empreinte FNV-1a des particules visibles et des positions.
+        visible = system.prepare();
+
+        for( size_t i = 0; i != visible; i++ )
+        {
+            hash = ( hash ^ (Uint32)( emitter->getScreenX()[i] * 64.0f ) ) * 16777619u;
+            hash = ( hash ^ (Uint32)( emitter->getScreenY()[i] * 64.0f ) ) * 16777619u;
+            hash = ( hash ^ (Uint32)emitter->getFrames()[i] ) * 16777619u;
+        }
+
+        for( size_t i = 0; i != registry.getTransforms().getCount(); i++ )
+        {
+            const Point2f& position = registry.getTransforms().at( i ).position;
+
+            hash = ( hash ^ (Uint32)( position.mX * 64.0f ) ) * 16777619u;
+            hash = ( hash ^ (Uint32)( position.mY * 64.0f ) ) * 16777619u;
+        }
+
+        reference = pass == 0 ? total : reference;
+        expected  = pass == 0 ? hash  : expected;
+
+        oss << count
+            << " particle(s) and object(s) over "
+            << ticks
+            << " tick(s) with "
+            << gJobSystem.getThreadCount()
+            << " thread(s): "
+            << ( ticks != 0 ? total * 1000000 / frequency / ticks : 0 )
+            << " us per tick, speedup x"
+            << ( total != 0 ? (float)reference / (float)total : 0.0f )
+            << ", "
+            << ( hash == expected ? "same" : "DIFFERENT" )
+            << " result.";
+
+        log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    gJobSystem.stop();
+}
+
+//! @brief Procédure de mesure de la cadence des images.
+//!
+//! Une boucle factice (attente active de work µs par image, pour la mise à
+//! jour et le rendu) tourne d'abord sans cadence, comme l'ancienne boucle
+//! sans synchronisation verticale, puis cadencée à 60, 120 et 240 images
+//! par seconde. Le temps processeur est mesuré par clock(), la régularité
+//! par l'écart type et les centiles des durées d'images. Le moteur n'a pas
+//! besoin d'être initialisé.
+//! @param frames Le nombre d'images par passe.
+//! @param work Le travail d'une image, en µs.
+void cirion::benchPacing( int frames, int work )
+{
+    static const int rates[] = { 0, 60, 120, 240 };
+
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+
+    for( size_t pass = 0; pass != sizeof(rates) / sizeof(int); pass++ )
+    {
+        ostringstream oss;
+        FramePacer    pacer;
+        FrameStats    stats( frames > 0 ? frames : 1 );
+        FrameSummary  summary;
+        double        sum     = 0.0;
+        double        squares = 0.0;
+        double        mean;
+        clock_t       cpu;
+        Uint64        start;
+        Uint64        wall;
+        Uint64        previous;
+
+        pacer.setTargetRate( rates[pass] );
+        pacer.wait( false );
+
+        cpu      = clock();
+        start    = SDL_GetPerformanceCounter();
+        previous = start;
+
+        for( int frame = 0; frame != frames; frame++ )
+        {
+            Uint64 now      = SDL_GetPerformanceCounter();
+            Uint64 end      = now + frequency * work / 1000000;
+            Uint64 duration;
+
+            while( now < end )
+            {
+                now = SDL_GetPerformanceCounter();
+            }
+
+            pacer.wait( false );
+
+            now       = SDL_GetPerformanceCounter();
+            duration  = HrTimer::toNanoseconds( now - previous );
+            previous  = now;
+            sum      += (double)duration;
+            squares  += (double)duration * (double)duration;
+            stats.add( duration );
+        }
+
+        wall    = SDL_GetPerformanceCounter() - start;
+        cpu     = clock() - cpu;
+        summary = stats.getTotalSummary();
+        mean    = frames > 0 ? sum / frames : 0.0;
+
+        if( rates[pass] > 0 )
+        {
+            oss << rates[pass]
+                << " fps target: ";
+        }
+
+        else
+        {
+            oss << "Unpaced: ";
+        }
+
+        oss << frames
+            << " frame(s) of "
+            << work
+            << " us work, "
+            << ( wall != 0 ? (double)frames * frequency / wall : 0.0 )
+            << " fps, "
+            << ( wall != 0
+                 ? (double)cpu / CLOCKS_PER_SEC * frequency / wall * 100.0
+                 : 0.0 )
+            << " % CPU; frame time avg "
+            << mean / 1000000.0
+            << " ms, stddev "
+            << ( frames > 0 ? sqrt( squares / frames - mean * mean ) / 1000000.0 : 0.0 )
+            << " ms, p99 "
+            << summary.p99 / 1000000.0
+            << " ms, max "
+            << summary.max / 1000000.0
+            << " ms; "
+            << pacer.getSpinTime() / 1000 / ( frames > 0 ? frames : 1 )
+            << " us spun per frame";
+
+        if( rates[pass] > 0 )
+        {
+            oss << ", sleep overshoot "
+                << pacer.getOvershoot() / 1000
+                << " us";
+        }
+
+        oss << ".";
+
+        log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+}
+
+//! @brief Procédure de mesure du coût d'un report au journal.
+//!
+//! Deux passes: écriture directe, puis confiée au fil d'écriture. Le coût
+//! rapporté est celui de l'appelant; l'arrêt du fil, qui écrit les
+//! messages restants, est mesuré à part. Le moteur n'a pas besoin d'être
+//! initialisé.
+//! @param count Le nombre de messages par passe.
+void cirion::benchLog( int count )
+{
+    unsigned int dropped = getDroppedLogCount();
+
+    for( int pass = 0; pass != 2; pass++ )
+    {
+        ostringstream oss;
+        Uint64        start;
+        Uint64        wall;
+        Uint64        drain;
+
+        if( pass == 0 )
+        {
+            stopLogging();
+        }
+
+        else
+        {
+            startLogging();
+        }
+
+        start = SDL_GetPerformanceCounter();
+
+        for( int i = 0; i != count; i++ )
+        {
+            log( "Benchmark message.", __PRETTY_FUNCTION__ );
+        }
+
+        wall  = SDL_GetPerformanceCounter() - start;
+        start = SDL_GetPerformanceCounter();
+        stopLogging();
+        drain = SDL_GetPerformanceCounter() - start;
+
+        oss << ( pass == 0 ? "Synchronous: " : "Asynchronous: " )
+            << count
+            << " message(s), "
+            << ( count > 0 ? HrTimer::toNanoseconds( wall ) / count : 0 )
+            << " ns per call, "
+            << HrTimer::toNanoseconds( drain ) / 1000000
+            << " ms to drain, "
+            << getDroppedLogCount() - dropped
+            << " dropped.";
+
+        dropped = getDroppedLogCount();
+
+        log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+}
+
+//! @brief Procédure de mesure du débit de la simulation, sans rendu.
+//!
+//! Le scénario est monté dans le moteur initialisé: la map donnée, des
+//! personnages répartis en grille au-dessus d'elle, qui tombent puis
+//! courent selon les entrées (relecture éventuelle comprise), et un champ
+//! de bulles. simulate() enchaîne ensuite les pas au plus vite et rapporte
+//! le temps de chaque sous-système. Les objets sont libérés par quit().
+//! @param name Le nom du fichier CMF.
+//! @param entities Le nombre de personnages.
+//! @param particles Le nombre de particules, 0 pour aucun émetteur.
+//! @param ticks Le nombre de pas de simulation.
+//! @throw CiException en cas d'échec.
+void cirion::benchSimulation( const char* name, int entities, int particles,
+                              int ticks )
+{
+    EmitterConfig config;
+    int           columns;
+
+    gWorld.create( name );
+
+    // --- Personnages, un toutes les deux tuiles. -----------------------------
+    columns = gWorld.getTileMap().getWidth() / 2 - 1;
+    columns = columns > 0 ? columns : 1;
+
+    for( int i = 0; i != entities; i++ )
+    {
+        Hiro* hiro = new Hiro();
+
+        try
+        {
+            hiro->create( "DummyAlt" );
+        }
+
+        catch( CiException const& e )
+        {
+            delete hiro;
+            throw;
+        }
+
+        hiro->warp( Point2f( (float)( ( 1 + i % columns ) * 2 * TILE_W ),
+                             (float)( ( 1 + i / columns ) * TILE_H ) ) );
+        gGameObjects.push_back( hiro );
+    }
+
+    // --- Champ de bulles. ----------------------------------------------------
+    if( particles > 0 )
+    {
+        loadEmitterConfig( "Bubbles", config );
+        config.count = particles;
+        gParticleSystem.add( config, getTexture( config.texture.c_str() ) );
+    }
+
+    simulate( ticks );
+}
@@ -0,0 +1,875 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    cef.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Format d'entité compilé.
+ */
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/stat.h> // stat(), mkdir()
+#include <tinyxml2.h>
+#include <Cirion/cef.hpp>
+#include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/log.hpp>
+#include <Cirion/sprite.hpp>
+#include <Cirion/statemachine.hpp>
+#include <Cirion/xmlerror.hpp>
+
+#ifdef _WIN32
+    #include <direct.h> // _mkdir()
+#endif
+
+using namespace std;
+using namespace cirion;
+using namespace tinyxml2;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe Cef.
+cirion::Cef::Cef():
+    mSourceTime( 0 )
+{
+}
+
+//! @brief Déstructeur pour la classe Cef.
+cirion::Cef::~Cef()
+{
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de chargement d'une entité.
+//!
+//! La version compilée est lue depuis le cache si elle a été compilée depuis
+//! le XML actuel; sinon le XML est recompilé et le cache réécrit.
+//! @param name Nom de l'entité dans le répertoire des entités.
+//! @throw CiException en cas d'échec.
+void cirion::Cef::load( const char* name )
+{
+    CIRION_PROFILE_ZONE( "Cef::load" );
+
+    ostringstream filepath;   //!< Le chemin du XML.
+    ostringstream cachepath;  //!< Le chemin de l'entité compilée.
+    ostringstream oss;        //!< Un flux de chaîne pour le journal.
+    struct stat   st;
+    Sint64        sourceTime; //!< Date de modification du XML.
+    bool          isCompiled; //!< Indique si le cache est à jour.
+    Uint64        start = SDL_GetPerformanceCounter();
+
+    // --- Construction des chemins du XML et de l'entité compilée. ------------
+    filepath << gWorkingDir
+             << "/Entities/"
+             << name
+             << ".xml";
+
+    cachepath << gWorkingDir
+              << "/Cache/"
+              << name
+              << ".cef";
+
+    // --- Le cache est-il à jour ? --------------------------------------------
+
+    /* Sans XML (distribution sans les sources), la version compilée fait
+    foi. */
+    sourceTime = stat( filepath.str().c_str(), &st ) == 0
+               ? (Sint64)st.st_mtime
+               : -1;
+
+    try
+    {
+        read( cachepath.str().c_str() );
+        isCompiled = sourceTime == -1 || mSourceTime == sourceTime;
+    }
+
+    catch( CiException const& e )
+    {
+        isCompiled = false;
+    }
+
+    // --- Sinon, (re)compilation depuis le XML. -------------------------------
+    if( !isCompiled )
+    {
+        compile( filepath.str().c_str() );
+        mSourceTime = sourceTime;
+
+        /* Un cache impossible à écrire ne doit pas empêcher le chargement. */
+        try
+        {
+            write( cachepath.str().c_str() );
+        }
+
+        catch( CiException const& e )
+        {
+            log( e );
+        }
+
+        gStats.entityCacheMisses++;
+    }
+
+    else
+    {
+        gStats.entityCacheHits++;
+    }
+
+    oss << "Entity \""
+        << name
+        << "\" loaded from "
+        << ( isCompiled ? "compiled cache" : "xml (compiled)" )
+        << " in "
+        << ( SDL_GetPerformanceCounter() - start ) * 1000000
+         / SDL_GetPerformanceFrequency()
+        << " us.";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
+
+//! @brief Procédure de compilation du XML d'une entité.
+//! @param filepath Chemin vers le fichier XML.
+//! @throw CiException en cas d'échec.
+void cirion::Cef::compile( const char* filepath )
+{
+    XMLDocument xml;
+    XMLElement* entityNode;
+    XMLElement* spriteNode;
+
+    clear();
+
+    if( xml.LoadFile( filepath ) != XML_NO_ERROR )
+    {
+        ostringstream oss;
+
+        oss << "Unable to load the entity xml file \""
+            << filepath
+            << "\": "
+            << getXmlErrorStr( xml.ErrorID() );
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    // Récuperation du noeud <entity>.
+    entityNode = xml.FirstChildElement( (const char*)"entity" );
+
+    if( entityNode == NULL )
+    {
+        throw CiException( "Unable to compile entity: Expected <entity> node.",
+            __PRETTY_FUNCTION__ );
+    }
+
+    // --- Parcours de tous les noeuds <sprite>. -------------------------------
+    spriteNode = entityNode->FirstChildElement( (const char*)"sprite" );
+
+    while( spriteNode != NULL )
+    {
+        mSprites.push_back( SpriteData() );
+
+        try
+        {
+            compileSprite( spriteNode, &mSprites.back() );
+        }
+
+        catch( CiException const& e )
+        {
+            clear();
+            throw;
+        }
+
+        spriteNode = spriteNode->NextSiblingElement( (const char*)"sprite" );
+    }
+}
+
+//! @brief Procédure de lecture d'une entité compilée.
+//! @param filepath Chemin vers le fichier.
+//! @throw CiException en cas d'échec.
+void cirion::Cef::read( const char* filepath )
+{
+    ostringstream oss;
+    ifstream      file( filepath, ios::binary | ios::in );
+    vector<Uint8> buffer;
+    size_t        size;
+    size_t        offset      = 0;
+    bool          isTruncated = false;
+    CefHeader     header;
+
+    clear();
+
+    if( !file.is_open() )
+    {
+        oss << "Unable to read compiled entity \""
+            << filepath
+            << "\": file not found.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    // --- Lecture du fichier en un seul bloc. ---------------------------------
+    file.seekg( 0, ios::end );
+    size = (size_t)file.tellg();
+    file.seekg( 0, ios::beg );
+
+    if( size < sizeof(CefHeader) )
+    {
+        oss << "Unable to read compiled entity \""
+            << filepath
+            << "\": truncated header.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    buffer.resize( size );
+    file.read( (char*)&buffer[0], size );
+    file.close();
+
+    memcpy( &header, &buffer[0], sizeof(CefHeader) );
+    offset += sizeof(CefHeader);
+
+    if( header.magic != CEF_MAGIC || header.version != CEF_VERSION )
+    {
+        oss << "Unable to read compiled entity \""
+            << filepath
+            << "\": wrong magic or version.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    // --- Lecture des sprites, animations et images. --------------------------
+
+    /* Les compteurs ne sont pas dignes de confiance: chaque enregistrement est
+    borné par la taille du fichier avant d'être lu. */
+    isTruncated = header.spriteCount > ( size - offset ) / sizeof(CefSprite);
+
+    if( !isTruncated )
+    {
+        mSprites.resize( header.spriteCount );
+    }
+
+    for( Uint32 i = 0; i != mSprites.size() && !isTruncated; i++ )
+    {
+        CefSprite   sprite;
+        SpriteData& data = mSprites[i];
+
+        if( offset + sizeof(CefSprite) > size )
+        {
+            isTruncated = true;
+            break;
+        }
+
+        memcpy( &sprite, &buffer[offset], sizeof(CefSprite) );
+        offset += sizeof(CefSprite);
+
+        memcpy( data.name,        sprite.name,        16 );
+        memcpy( data.spritesheet, sprite.spritesheet, 16 );
+        data.name[15]        = '\0';
+        data.spritesheet[15] = '\0';
+        data.srcW            = sprite.srcW;
+        data.srcH            = sprite.srcH;
+        data.hitbox.x        = sprite.hitbox[0];
+        data.hitbox.y        = sprite.hitbox[1];
+        data.hitbox.w        = sprite.hitbox[2];
+        data.hitbox.h        = sprite.hitbox[3];
+        data.initialAnimation = sprite.initialAnimation;
+
+        if( sprite.animationCount > ( size - offset ) / sizeof(CefAnimation) )
+        {
+            isTruncated = true;
+            break;
+        }
+
+        data.animations.resize( sprite.animationCount );
+
+        for( Uint32 j = 0; j != sprite.animationCount && !isTruncated; j++ )
+        {
+            CefAnimation animation;
+
+            if( offset + sizeof(CefAnimation) > size )
+            {
+                isTruncated = true;
+                break;
+            }
+
+            memcpy( &animation, &buffer[offset], sizeof(CefAnimation) );
+            offset += sizeof(CefAnimation);
+
+            memcpy( data.animations[j].name, animation.name, 16 );
+            data.animations[j].name[15] = '\0';
+
+            if( animation.frameCount > ( size - offset ) / sizeof(CefFrame) )
+            {
+                isTruncated = true;
+                break;
+            }
+
+            data.animations[j].frames.resize( animation.frameCount );
+
+            for( Uint32 k = 0; k != animation.frameCount; k++ )
+            {
+                CefFrame cefFrame;
+                Frame&   frame = data.animations[j].frames[k];
+
+                memcpy( &cefFrame, &buffer[offset], sizeof(CefFrame) );
+                offset += sizeof(CefFrame);
+
+                frame.left        = Point2i( cefFrame.left[0],  cefFrame.left[1]  );
+                frame.right       = Point2i( cefFrame.right[0], cefFrame.right[1] );
+                frame.leftTrim.x  = cefFrame.leftTrim[0];
+                frame.leftTrim.y  = cefFrame.leftTrim[1];
+                frame.leftTrim.w  = cefFrame.leftTrim[2];
+                frame.leftTrim.h  = cefFrame.leftTrim[3];
+                frame.rightTrim.x = cefFrame.rightTrim[0];
+                frame.rightTrim.y = cefFrame.rightTrim[1];
+                frame.rightTrim.w = cefFrame.rightTrim[2];
+                frame.rightTrim.h = cefFrame.rightTrim[3];
+                frame.duration    = cefFrame.duration;
+            }
+        }
+
+        // Transitions de la machine à états.
+        if(    isTruncated
+            || sprite.transitionCount > ( size - offset ) / sizeof(CefTransition) )
+        {
+            isTruncated = true;
+            break;
+        }
+
+        data.transitions.resize( sprite.transitionCount );
+
+        for( Uint32 j = 0; j != sprite.transitionCount; j++ )
+        {
+            CefTransition transition;
+
+            memcpy( &transition, &buffer[offset], sizeof(CefTransition) );
+            offset += sizeof(CefTransition);
+
+            data.transitions[j].from    = transition.from;
+            data.transitions[j].to      = transition.to;
+            data.transitions[j].require = transition.require;
+            data.transitions[j].forbid  = transition.forbid;
+        }
+
+        /* Des identifiants hors bornes planteraient setAnimation( int ). */
+        if( !isValid( data ) )
+        {
+            isTruncated = true;
+            break;
+        }
+    }
+
+    // --- Le fichier doit avoir été lu exactement. ----------------------------
+    if( isTruncated || offset != size )
+    {
+        clear();
+
+        oss << "Unable to read compiled entity \""
+            << filepath
+            << "\": truncated or corrupted data.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    mSourceTime = header.sourceTime;
+}
+
+//! @brief Procédure d'écriture de l'entité compilée sur le disque.
+//! @param filepath Chemin vers le fichier.
+//! @throw CiException en cas d'échec.
+void cirion::Cef::write( const char* filepath )
+{
+    ostringstream oss;
+    string        directory( filepath );
+    fstream       file;
+    CefHeader     header;
+
+    // --- Création du répertoire du cache, si besoin. -------------------------
+    if( directory.find_last_of( '/' ) != string::npos )
+    {
+        directory.erase( directory.find_last_of( '/' ) );
+
+        #ifdef _WIN32
+            _mkdir( directory.c_str() );
+        #else
+            mkdir( directory.c_str(), 0755 );
+        #endif
+    }
+
+    // --- Ouverture du fichier. -----------------------------------------------
+    file.open( filepath, ios::binary | ios::out | ios::trunc );
+
+    if( !file.is_open() )
+    {
+        oss << "Unable to write compiled entity \""
+            << filepath
+            << "\": unable to create output file.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    // --- Ecriture de l'en-tête. ----------------------------------------------
+    memset( &header, 0x00, sizeof(CefHeader) );
+
+    header.magic       = CEF_MAGIC;
+    header.version     = CEF_VERSION;
+    header.sourceTime  = mSourceTime;
+    header.spriteCount = (Uint32)mSprites.size();
+
+    file.write( (const char*)&header, sizeof(CefHeader) );
+
+    // --- Ecriture des sprites, animations et images. -------------------------
+    for( size_t i = 0; i != mSprites.size(); i++ )
+    {
+        const SpriteData& data = mSprites[i];
+        CefSprite         sprite;
+
+        memset( &sprite, 0x00, sizeof(CefSprite) );
+        memcpy( sprite.name,        data.name,        16 );
+        memcpy( sprite.spritesheet, data.spritesheet, 16 );
+        sprite.srcW             = data.srcW;
+        sprite.srcH             = data.srcH;
+        sprite.hitbox[0]        = data.hitbox.x;
+        sprite.hitbox[1]        = data.hitbox.y;
+        sprite.hitbox[2]        = data.hitbox.w;
+        sprite.hitbox[3]        = data.hitbox.h;
+        sprite.initialAnimation = data.initialAnimation;
+        sprite.animationCount   = (Uint32)data.animations.size();
+        sprite.transitionCount  = (Uint32)data.transitions.size();
+
+        file.write( (const char*)&sprite, sizeof(CefSprite) );
+
+        for( size_t j = 0; j != data.animations.size(); j++ )
+        {
+            const Animation& animation = data.animations[j];
+            CefAnimation     cefAnimation;
+
+            memset( &cefAnimation, 0x00, sizeof(CefAnimation) );
+            memcpy( cefAnimation.name, animation.name, 16 );
+            cefAnimation.frameCount = (Uint32)animation.frames.size();
+
+            file.write( (const char*)&cefAnimation, sizeof(CefAnimation) );
+
+            for( size_t k = 0; k != animation.frames.size(); k++ )
+            {
+                const Frame& frame = animation.frames[k];
+                CefFrame     cefFrame;
+
+                cefFrame.left[0]      = frame.left.mX;
+                cefFrame.left[1]      = frame.left.mY;
+                cefFrame.right[0]     = frame.right.mX;
+                cefFrame.right[1]     = frame.right.mY;
+                cefFrame.leftTrim[0]  = frame.leftTrim.x;
+                cefFrame.leftTrim[1]  = frame.leftTrim.y;
+                cefFrame.leftTrim[2]  = frame.leftTrim.w;
+                cefFrame.leftTrim[3]  = frame.leftTrim.h;
+                cefFrame.rightTrim[0] = frame.rightTrim.x;
+                cefFrame.rightTrim[1] = frame.rightTrim.y;
+                cefFrame.rightTrim[2] = frame.rightTrim.w;
+                cefFrame.rightTrim[3] = frame.rightTrim.h;
+                cefFrame.duration     = frame.duration;
+
+                file.write( (const char*)&cefFrame, sizeof(CefFrame) );
+            }
+        }
+
+        for( size_t j = 0; j != data.transitions.size(); j++ )
+        {
+            CefTransition transition;
+
+            transition.from    = data.transitions[j].from;
+            transition.to      = data.transitions[j].to;
+            transition.require = data.transitions[j].require;
+            transition.forbid  = data.transitions[j].forbid;
+
+            file.write( (const char*)&transition, sizeof(CefTransition) );
+        }
+    }
+
+    // --- Fermeture. ----------------------------------------------------------
+    file.close();
+}
+
+//! @brief Procédure de vidage des données.
+void cirion::Cef::clear()
+{
+    mSourceTime = 0;
+    mSprites.clear();
+}
+
+//! @brief Procédure d'échange des données avec un autre Cef.
+//!
+//! Les données ne sont ni copiées ni déplacées: les pointeurs vers les
+//! sprites, animations et images de chacun restent valides et suivent
+//! leur nouveau propriétaire.
+//! @param cef Le Cef à échanger.
+void cirion::Cef::swap( Cef& cef )
+{
+    Sint64 sourceTime = mSourceTime;
+
+    mSourceTime     = cef.mSourceTime;
+    cef.mSourceTime = sourceTime;
+    mSprites.swap( cef.mSprites );
+}
+
+//! @brief Fonction accesseur.
+//! @param name Le nom du sprite.
+//! @return Pointeur vers les données du sprite, ou NULL.
+SpriteData* cirion::Cef::getSprite( const char* name )
+{
+    for( size_t i = 0; i != mSprites.size(); i++ )
+    {
+        if( strcmp( mSprites[i].name, name ) == 0 )
+        {
+            return &mSprites[i];
+        }
+    }
+
+    return NULL;
+}
+
+//! @brief Fonction accesseur.
+//! @return Les données de tous les sprites de l'entité.
+vector<SpriteData>& cirion::Cef::getSprites()
+{
+    return mSprites;
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées.                                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de compilation d'un noeud <sprite>.
+//! @param *spriteNode Pointeur vers le noeud <sprite>.
+//! @param *data Pointeur vers les données à remplir.
+//! @throw CiException en cas d'échec.
+void cirion::Cef::compileSprite( XMLElement* spriteNode, SpriteData* data )
+{
+    XMLElement* hitboxNode;
+    XMLElement* animationNode;
+    XMLElement* frameNode;
+    XMLElement* leftNode;
+    XMLElement* rightNode;
+    XMLElement* statesNode;
+    XMLElement* transitionNode;
+    Animation   animation;
+    Frame       frame;
+
+    // Récuperation du nom du sprite et de sa feuille de sprites.
+    copyName( data->name,
+              spriteNode->Attribute( (const char*)"name" ) != NULL
+              ? spriteNode->Attribute( (const char*)"name" )
+              : "",
+              "sprite" );
+
+    if( spriteNode->Attribute( (const char*)"spritesheet" ) == NULL )
+    {
+        throw CiException( "Unable to fetch sprite data: "
+            "Expected spritesheet attribute.", __PRETTY_FUNCTION__ );
+    }
+
+    copyName( data->spritesheet,
+              spriteNode->Attribute( (const char*)"spritesheet" ),
+              "spritesheet" );
+
+    // Définition des dimensions du sprite.
+    data->srcW = spriteNode->IntAttribute( (const char*)"src_w" );
+    data->srcH = spriteNode->IntAttribute( (const char*)"src_h" );
+
+    // Récuperation du noeud <hitbox>
+    hitboxNode = spriteNode->FirstChildElement( (const char*)"hitbox" );
+
+    if( hitboxNode == NULL )
+    {
+        ostringstream oss;
+
+        oss << "Unable to fetch sprite data: "
+            << "Expected <hitbox> node.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    data->hitbox.x = hitboxNode->IntAttribute( (const char*)"x" );
+    data->hitbox.y = hitboxNode->IntAttribute( (const char*)"y" );
+    data->hitbox.w = hitboxNode->IntAttribute( (const char*)"w" );
+    data->hitbox.h = hitboxNode->IntAttribute( (const char*)"h" );
+
+    // Récuperation du 1er noeud <animation>.
+    animationNode = spriteNode->FirstChildElement( (const char*)"animation" );
+
+    if( animationNode == NULL )
+    {
+        ostringstream oss;
+
+        oss << "Unable to fetch sprite data: "
+            << "Expected <animation> node.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    // --- Parcours de tous les noeuds <animation>. ----------------------------
+    while( animationNode != NULL )
+    {
+        animation.frames.clear();
+
+        // Récuperation du nom de l'animation.
+        copyName( animation.name,
+                  animationNode->Attribute( "name" ) != NULL
+                  ? animationNode->Attribute( "name" )
+                  : "",
+                  "animation" );
+
+        // Récuperation du noeud <frame>.
+        frameNode = animationNode->FirstChildElement( "frame" );
+
+        if( frameNode == NULL )
+        {
+            ostringstream oss;
+
+            oss << "Unable to fetch sprite data: "
+                << "Expected <frame> node.";
+
+            throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+        }
+
+        // --- Parcours de tous les noeuds <frame>. ----------------------------
+        while( frameNode != NULL )
+        {
+            // Récuperation de la durée d'affichage de l'image.
+            frame.duration = frameNode->IntAttribute( "duration" );
+
+            // Récuperation du noeud <left>.
+            leftNode = frameNode->FirstChildElement( "left" );
+
+            if( leftNode == NULL )
+            {
+                ostringstream oss;
+
+                oss << "Unable to fetch sprite data: "
+                    << "Expected <left> node.";
+
+                throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+            }
+
+            // Récuperation des coordonnées sources du fragment gauche.
+            frame.left.mX = leftNode->IntAttribute( "src_x" );
+            frame.left.mY = leftNode->IntAttribute( "src_y" );
+            compileTrim( leftNode, data, &frame.leftTrim );
+
+            // Récuperation du noeud <right>.
+            rightNode = frameNode->FirstChildElement( "right" );
+
+            if( rightNode == NULL )
+            {
+                ostringstream oss;
+
+                oss << "Unable to fetch sprite data: "
+                    << "Expected <right> node.";
+
+                throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+            }
+
+            // Récuperation des coordonnées sources du fragment droit.
+            frame.right.mX = rightNode->IntAttribute( "src_x" );
+            frame.right.mY = rightNode->IntAttribute( "src_y" );
+            compileTrim( rightNode, data, &frame.rightTrim );
+
+            // Ajout de l'image dans l'animation.
+            animation.frames.push_back( frame );
+
+            // Noeud <frame> suivant.
+            frameNode = frameNode->NextSiblingElement();
+        }
+
+        // Ajout de l'animation dans les animations du sprite.
+        data->animations.push_back( animation );
+
+        // Noeud <animation> suivant.
+        animationNode = animationNode->NextSiblingElement( "animation" );
+    }
+
+    // --- Machine à états, optionnelle. ---------------------------------------
+    statesNode = spriteNode->FirstChildElement( (const char*)"states" );
+
+    data->initialAnimation = 0;
+    data->transitions.clear();
+
+    if( statesNode != NULL )
+    {
+        if( statesNode->Attribute( "initial" ) != NULL )
+        {
+            data->initialAnimation = findAnimation( data,
+                statesNode->Attribute( "initial" ) );
+        }
+
+        // Les noms sont résolus en identifiants une fois pour toutes.
+        for( transitionNode = statesNode->FirstChildElement( "transition" );
+             transitionNode != NULL;
+             transitionNode = transitionNode->NextSiblingElement( "transition" ) )
+        {
+            Transition  transition;
+            const char* from = transitionNode->Attribute( "from" );
+
+            transition.from    = ( from == NULL || strcmp( from, "*" ) == 0 )
+                               ? -1
+                               : findAnimation( data, from );
+            transition.to      = findAnimation( data,
+                                 transitionNode->Attribute( "to" ) != NULL
+                                 ? transitionNode->Attribute( "to" )
+                                 : "" );
+            transition.require = parseStateFlags(
+                                 transitionNode->Attribute( "when" ) );
+            transition.forbid  = parseStateFlags(
+                                 transitionNode->Attribute( "unless" ) );
+
+            data->transitions.push_back( transition );
+        }
+    }
+}
+
+//! @brief Procédure de lecture du rognage d'un fragment <left> ou <right>.
+//!
+//! Les attributs trim_x, trim_y, trim_w et trim_h sont produits hors ligne
+//! par trimEntity(); sans eux, le fragment couvre toute la cellule.
+//! @param *node Pointeur vers le noeud du fragment.
+//! @param *data Pointeur vers les données du sprite (dimensions de cellule).
+//! @param *trim Pointeur vers le rognage à remplir.
+//! @throw CiException si le rognage déborde de la cellule.
+void cirion::Cef::compileTrim( XMLElement* node,
+                               const SpriteData* data,
+                               SDL_Rect* trim )
+{
+    trim->x = 0;
+    trim->y = 0;
+    trim->w = data->srcW;
+    trim->h = data->srcH;
+
+    node->QueryIntAttribute( "trim_x", &trim->x );
+    node->QueryIntAttribute( "trim_y", &trim->y );
+    node->QueryIntAttribute( "trim_w", &trim->w );
+    node->QueryIntAttribute( "trim_h", &trim->h );
+
+    if(    trim->x < 0 || trim->y < 0 || trim->w < 0 || trim->h < 0
+        || trim->x + trim->w > data->srcW
+        || trim->y + trim->h > data->srcH )
+    {
+        ostringstream oss;
+
+        oss << "Unable to fetch sprite data: "
+            << "Trim rect exceeds the "
+            << data->srcW
+            << "x"
+            << data->srcH
+            << " cell.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+}
+
+//! @brief Fonction de résolution du nom d'une animation en identifiant.
+//! @param data Les données du sprite.
+//! @param name Le nom de l'animation.
+//! @return L'identifiant de l'animation.
+//! @throw CiException si l'animation n'existe pas.
+int cirion::Cef::findAnimation( const SpriteData* data, const char* name )
+{
+    for( size_t i = 0; i != data->animations.size(); i++ )
+    {
+        if( strcmp( data->animations[i].name, name ) == 0 )
+        {
+            return (int)i;
+        }
+    }
+
+    ostringstream oss;
+
+    oss << "Unable to fetch sprite data: state machine refers to unknown "
+        << "animation \""
+        << name
+        << "\".";
+
+    throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
+
+//! @brief Fonction de vérification des identifiants d'animations d'un sprite.
+//! @param data Les données du sprite.
+//! @return Vrai si tous les identifiants désignent une animation non vide.
+bool cirion::Cef::isValid( const SpriteData& data )
+{
+    int count = (int)data.animations.size();
+
+    if( data.initialAnimation < 0 || data.initialAnimation >= count )
+    {
+        return false;
+    }
+
+    for( int i = 0; i != count; i++ )
+    {
+        if( data.animations[i].frames.empty() )
+        {
+            return false;
+        }
+    }
+
+    for( size_t i = 0; i != data.transitions.size(); i++ )
+    {
+        if(    data.transitions[i].from < -1
+            || data.transitions[i].from >= count
+            || data.transitions[i].to   <  0
+            || data.transitions[i].to   >= count )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//! @brief Procédure de copie d'un nom dans un champ de 16 caractères.
+//! @param name Le champ de destination.
+//! @param value Le nom à copier.
+//! @param what La nature du nom, pour le journal.
+//! @throw CiException si le nom est trop long.
+void cirion::Cef::copyName( char* name, const char* value, const char* what )
+{
+    if( strlen( value ) > 15 )
+    {
+        ostringstream oss;
+
+        oss << "Unable to fetch sprite data: "
+            << what
+            << " name \""
+            << value
+            << "\" exceeds 15 characters.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    memset( name, 0x00, 16 );
+    strcpy( name, value );
+}
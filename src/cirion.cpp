@@ -26,15 +26,34 @@
  * @brief   Coeur du moteur
  */
 
+#include <algorithm>
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <vector>
 #include <SDL2/SDL.h>
+#include <Cirion/assetwatcher.hpp>
 #include <Cirion/ciexception.hpp>
 #include <Cirion/cirion.hpp>
 #include <Cirion/config.hpp>
+#include <Cirion/eventdispatcher.hpp>
+#include <Cirion/framepacer.hpp>
+#include <Cirion/framestats.hpp>
 #include <Cirion/gameobject.hpp>
+#include <Cirion/inputsystem.hpp>
+#include <Cirion/jobsystem.hpp>
 #include <Cirion/log.hpp>
+#include <Cirion/objectpool.hpp>
+#include <Cirion/overlay.hpp>
+#include <Cirion/particlesystem.hpp>
+#include <Cirion/pixelpool.hpp>
+#include <Cirion/profiler.hpp>
+#include <Cirion/prototype.hpp>
+#include <Cirion/registry.hpp>
+#include <Cirion/replay.hpp>
+#include <Cirion/sprite.hpp>
+#include <Cirion/statemachine.hpp>
+#include <Cirion/stats.hpp>
 #include <Cirion/texture.hpp>
 #include <Cirion/timer.hpp>
 #include <Cirion/world.hpp>
@@ -48,13 +67,37 @@ const int gRendererWidth = 320;
 const int gRendererHeight = 240;
 Config gConfig;
 bool gIsRunning;
-Timer gRenderTimer;
+bool gIsHeadless = false;
+Uint32 gFrame;
 SDL_Window* gWindow;
 SDL_Renderer* gRenderer;
 SDL_Event gEvent;
+SDL_Texture* gLastTexture;
 vector<Texture*> gTextures;
 vector<GameObject*> gGameObjects;
+vector<EntityPrototype*> gPrototypes;
 World gWorld;
+Stats gStats;
+FrameStats gFrameStats;
+FrameStats gUpdateStats;
+FrameStats gRenderStats;
+FrameStats gInputLatency;
+FrameStats* gSubsystemStats = NULL;
+AssetWatcher gAssetWatcher;
+AnimationSystem gAnimationSystem;
+CollisionSystem gCollisionSystem;
+EventDispatcher gEventDispatcher;
+FramePacer gFramePacer;
+InputSystem gInputSystem;
+JobSystem gJobSystem;
+PixelPool gPixelPool;
+Profiler gProfiler;
+Registry gRegistry;
+Replay gReplay;
+ObjectPool gSpritePool( sizeof(Sprite) );
+ComponentPool<StateMachine> gStateMachines;
+ParticleSystem gParticleSystem;
+Overlay gOverlay;
 
 //! @brief Procédure d'initialisation du moteur.
 //! @throw CiException en cas d'échec.
@@ -63,6 +106,8 @@ void cirion::init()
     ostringstream oss;
     Uint32 windowFlags;
     Uint32 rendererFlags;
+    SDL_DisplayMode displayMode;
+    int targetFps;
 
     oss << "Initializing Cirion Engine v"
         << gVersion;
@@ -91,6 +136,12 @@ void cirion::init()
         throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
     }
 
+    // Écriture du journal par un fil dédié.
+    startLogging();
+
+    resetStats();
+    gStats.startupCounter = SDL_GetPerformanceCounter();
+
     // --- Création de la fenêtre SDL2. ----------------------------------------
     
     windowFlags  = SDL_WINDOW_HIDDEN; 
@@ -142,15 +193,64 @@ void cirion::init()
                               gRendererHeight );
 
     // --- Affichage de la fenêtre, nettoyage et actualisation du renderer. ----
-    SDL_ShowWindow( gWindow );
-    SDL_SetRenderDrawColor( gRenderer, 0x00, 0x00, 0x00, 0xFF );
-    SDL_RenderClear( gRenderer );
-    SDL_RenderPresent( gRenderer );
+    /* Sans affichage, la fenêtre reste cachée et rien n'y est présenté:
+    run() ne fait plus que simuler. */
+    if( !gIsHeadless )
+    {
+        SDL_ShowWindow( gWindow );
+        SDL_SetRenderDrawColor( gRenderer, 0x00, 0x00, 0x00, 0xFF );
+        SDL_RenderClear( gRenderer );
+        SDL_RenderPresent( gRenderer );
+    }
+
+    // --- Surveillance des ressources pour le rechargement à chaud. -----------
+    if( gConfig.mIsHotReloadEnabled )
+    {
+        gAssetWatcher.start( gWorkingDir );
+    }
+
+    // --- Démarrage des fils de travail. --------------------------------------
+    gJobSystem.start( gConfig.mJobThreads );
+
+    // --- Cadence des images. -------------------------------------------------
+    /* Sans cadence imposée, la synchronisation verticale cadence la boucle;
+    sans elle, la boucle suit le rafraîchissement de l'écran. */
+    targetFps = gConfig.mTargetFps;
+
+    if( targetFps <= 0 && !gConfig.mIsVsyncEnabled )
+    {
+        targetFps =    SDL_GetWindowDisplayMode( gWindow, &displayMode ) == 0
+                    && displayMode.refresh_rate > 0
+                  ? displayMode.refresh_rate
+                  : 60;
+    }
+
+    gFramePacer.setTargetRate( targetFps );
+    gFramePacer.setIdleTimeout( gConfig.mIdleTimeout );
+
+    // --- Actions du joueur. --------------------------------------------------
+    gInputSystem.setKeymap( gConfig.mKeyboardMap );
+    gInputSystem.setLatencyMeasured( gConfig.mIsLatencyMeasured );
+
+    // --- Incrustation des mesures de performance. ----------------------------
+    /* Facultative: sans sa police, le moteur démarre sans elle. */
+    try
+    {
+        gOverlay.create();
+        gOverlay.setVisible( gConfig.mIsOverlayVisible );
+    }
+
+    catch( CiException const& e )
+    {
+        log( e );
+    }
 }
 
 //! @brief Procédure de traîtement des évenements.
 void cirion::handleEvents()
 {
+    CIRION_PROFILE_ZONE( "handleEvents" );
+
     // Parcours de la liste des évenements en attentes
     while( SDL_PollEvent( &gEvent ) )
     {
@@ -166,74 +266,490 @@ void cirion::handleEvents()
                 case SDLK_ESCAPE:
                 gIsRunning = false;
                 break;
+
+                // Affichage des mesures de performance
+                case SDLK_F3:
+                gOverlay.toggle();
+                break;
+
+                // Trace des prochaines images
+                case SDLK_F12:
+                gProfiler.capture( PROFILER_HOTKEY_FRAMES, "trace.json" );
+                break;
             }
 
             break;
         }
 
-        // Traitement de l'évenement dans le monde
-        gWorld.handleEvent( &gEvent );
+        // Màj des actions du joueur
+        gInputSystem.handleEvent( &gEvent );
 
-        // Parcours de la liste des objets
-        for( size_t i = 0; i != gGameObjects.size(); i++ )
-        {
-            // Traîtement de l'évenement dans l'objet
-            gGameObjects[i]->handleEvent( &gEvent ); 
-        }
+        // Traîtement de l'évenement par les objets abonnés à son type
+        gEventDispatcher.dispatch( &gEvent );
+    }
+}
+
+//! Les noms des sous-systèmes, pour les rapports de simulate().
+static const char* const gSubsystemNames[SUBSYSTEM_COUNT] =
+{
+    "World",
+    "Objects",
+    "State machines",
+    "Animations",
+    "Registry",
+    "Collisions",
+    "Particles"
+};
+
+//! @brief Procédure de mesure d'un sous-système, pendant simulate().
+//! @param lap Le compteur de fin du sous-système précédent, avancé.
+//! @param subsystem Le sous-système qui vient de finir.
+static void lapSubsystem( Uint64& lap, Subsystem subsystem )
+{
+    Uint64 now;
+
+    if( gSubsystemStats == NULL )
+    {
+        return;
     }
+
+    now = SDL_GetPerformanceCounter();
+    gSubsystemStats[subsystem].add( HrTimer::toNanoseconds( now - lap ) );
+    lap = now;
 }
 
 //! @brief Procédure de mise à jour des composantes du moteur.
-void cirion::update( int timeStep )
+void cirion::update( float timeStep )
 {
+    CIRION_PROFILE_ZONE( "update" );
+
+    Uint64 lap = gSubsystemStats != NULL ? SDL_GetPerformanceCounter() : 0;
+
+    // Positions de départ, pour l'interpolation du rendu
+    gRegistry.storePositions();
+
     // Mise à jour du monde
     gWorld.update( timeStep );
+    lapSubsystem( lap, SUBSYSTEM_WORLD );
 
     // Parcours de la lise des objets
-    for( size_t i = 0; i != gGameObjects.size(); i++ )
     {
-        // Mise à jour de l'objet
-        gGameObjects[i]->update( timeStep );
+        CIRION_PROFILE_ZONE( "GameObject::update" );
+
+        for( size_t i = 0; i != gGameObjects.size(); i++ )
+        {
+            // Mise à jour de l'objet
+            gGameObjects[i]->update( timeStep );
+        }
     }
+
+    lapSubsystem( lap, SUBSYSTEM_OBJECTS );
+
+    // Évaluation groupée des transitions d'animations
+    updateStateMachines();
+    lapSubsystem( lap, SUBSYSTEM_STATES );
+
+    // Avancement groupé des animations
+    gAnimationSystem.update( timeStep );
+    lapSubsystem( lap, SUBSYSTEM_ANIMATIONS );
+
+    // Déplacement, placement des sprites et images, par composant
+    gRegistry.updateMotion( timeStep );
+    gRegistry.updateAttachments();
+    gRegistry.updateRenderables();
+    lapSubsystem( lap, SUBSYSTEM_REGISTRY );
+
+    // Détection groupée des contacts
+    gCollisionSystem.update();
+    lapSubsystem( lap, SUBSYSTEM_COLLISIONS );
+
+    // Avancement groupé des particules
+    gParticleSystem.update( timeStep );
+    lapSubsystem( lap, SUBSYSTEM_PARTICLES );
+
+    CIRION_PROFILE_COUNTER( "Objects", gRegistry.getCount() );
+    CIRION_PROFILE_COUNTER( "Particles", gParticleSystem.getCount() );
 }
 
+//! @brief Fonction de copie d'une texture dans le renderer, comptée dans les
+//!        statistiques.
+//! @param texture La texture.
+//! @param src Le rectangle source, NULL pour toute la texture.
+//! @param dest Le rectangle destination, NULL pour tout le renderer.
+//! @return Le résultat de SDL_RenderCopy().
+int cirion::renderCopy( SDL_Texture* texture,
+                        const SDL_Rect* src,
+                        const SDL_Rect* dest )
+{
+    gStats.textureSwitches += texture != gLastTexture ? 1 : 0;
+    gStats.drawCalls++;
+    gLastTexture = texture;
+
+    return SDL_RenderCopy( gRenderer, texture, src, dest );
+}
+
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+//! @brief Fonction de dessin de triangles texturés, comptée dans les
+//!        statistiques.
+//! @param texture La texture, NULL pour des triangles unis.
+//! @param vertices Les sommets.
+//! @param vertexCount Le nombre de sommets.
+//! @param indices Les indices des sommets des triangles.
+//! @param indexCount Le nombre d'indices.
+//! @return Le résultat de SDL_RenderGeometry().
+int cirion::renderGeometry( SDL_Texture* texture,
+                            const SDL_Vertex* vertices, int vertexCount,
+                            const int* indices, int indexCount )
+{
+    gStats.textureSwitches += texture != gLastTexture ? 1 : 0;
+    gStats.drawCalls++;
+    gLastTexture = texture;
+
+    return SDL_RenderGeometry( gRenderer, texture,
+                               vertices, vertexCount,
+                               indices, indexCount );
+}
+#endif
+
 //! @brief Procédure de rendu.
-void cirion::render()
+//! @param alpha Fraction de mise à jour écoulée depuis la dernière, [0, 1].
+void cirion::render( float alpha )
 {
+    CIRION_PROFILE_ZONE( "render" );
+
     // Nettoyage du renderer
     SDL_RenderClear( gRenderer );
+    gLastTexture = NULL;
+
+    // Dessin du monde et de ses objets
+    gWorld.draw( alpha );
+
+    // Dessin des particules, un lot par texture
+    gParticleSystem.draw( alpha );
+
+    // Incrustation des mesures, en un lot
+    gOverlay.draw();
+
+    // Actualisation du renderer
+    {
+        CIRION_PROFILE_ZONE( "SDL_RenderPresent" );
+        SDL_RenderPresent( gRenderer );
+    }
+
+    // Latence des appuis reflétés par cette image
+    gInputSystem.present();
+
+    // Les textures non utilisées pendant cette image sont évincables
+    trimTextures();
+    gFrame++;
+}
+
+//! @brief Fonction de comparaison de deux textures par ancienneté d'usage.
+static bool isLessRecentlyUsed( Texture* lhs, Texture* rhs )
+{
+    return lhs->getLastUsedFrame() < rhs->getLastUsedFrame();
+}
+
+//! @brief Procédure de respect du budget mémoire des textures: les textures
+//!        les moins récemment utilisées sont évincées jusqu'à repasser sous le
+//!        budget. Les textures utilisées pendant l'image courante sont
+//!        conservées, quitte à dépasser le budget. Le tileset et le
+//!        background du monde, dessinés à chaque image, comptent dans le
+//!        budget sans jamais être évincés.
+void cirion::trimTextures()
+{
+    CIRION_PROFILE_ZONE( "trimTextures" );
+
+    // Réutilisé d'une image à l'autre.
+    static vector<Texture*> candidates;
+
+    size_t budget = (size_t)gConfig.mTextureBudget * 1024 * 1024;
+    size_t memory = gWorld.getTextureMemorySize();
+
+    candidates.clear();
+
+    for( size_t i = 0; i != gTextures.size(); i++ )
+    {
+        memory += gTextures[i]->getMemorySize();
+
+        if(    gTextures[i]->getMemorySize() != 0
+            && gTextures[i]->getLastUsedFrame() != gFrame )
+        {
+            candidates.push_back( gTextures[i] );
+        }
+    }
+
+    // Un budget nul désactive l'éviction
+    if( budget != 0 && memory > budget )
+    {
+        sort( candidates.begin(), candidates.end(), isLessRecentlyUsed );
+
+        for( size_t i = 0; i != candidates.size() && memory > budget; i++ )
+        {
+            memory -= candidates[i]->getMemorySize();
+            candidates[i]->evict();
+        }
+    }
+
+    gStats.textureMemory = memory;
+}
 
-    // Dessin du monde
-    gWorld.draw();
+//! @brief Fonction de test d'inactivité: rien n'anime ni ne bouge, aucune
+//!        ressource n'attend d'être rechargée. Une image de plus serait
+//!        identique à la précédente.
+//!
+//! Les objets qui intègrent eux-mêmes leur vitesse (Hiro) la déclarent par
+//! GameObject::isActive(): gRegistry ne la voit pas.
+//! @return Vrai si le moteur est inactif.
+bool cirion::isIdle()
+{
+    if(    gParticleSystem.getCount() != 0
+        || gAssetWatcher.getPendingCount() != 0
+        || gAnimationSystem.isAnimating()
+        || gRegistry.isMoving() )
+    {
+        return false;
+    }
 
-    // Parcours de la liste des objets
     for( size_t i = 0; i != gGameObjects.size(); i++ )
     {
-        // Dessin de l'objet
-        gGameObjects[i]->draw();
+        if( gGameObjects[i]->isActive() )
+        {
+            return false;
+        }
     }
 
-    // Actualisation du renderer
-    SDL_RenderPresent( gRenderer );
+    return true;
+}
+
+//! @brief Fonction de calcul de la fréquence de simulation.
+//!
+//! Une relecture impose la fréquence de son enregistrement. Le pas, en ms,
+//! est fractionnaire: toute fréquence est tenue exactement (60 Hz, 144 Hz).
+//! @return La fréquence, en Hz.
+static int getSimulationRate()
+{
+    if( gReplay.isPlaying() && gReplay.getRate() > 0 )
+    {
+        return gReplay.getRate();
+    }
+
+    return gConfig.mSimulationRate;
 }
 
 //! @brief Procédure de boucle principale.
 void cirion::run()
 {
-    log( (const char*)"Entering main loop.", __PRETTY_FUNCTION__ );
+    ostringstream oss;
+    Uint64        frequency   = SDL_GetPerformanceFrequency();
+    int           rate        = getSimulationRate();
+    float         timeStep    = 1000.0f / rate;
+    Uint64        maxSteps    = gConfig.mMaxSimulationSteps > 0
+                              ? gConfig.mMaxSimulationSteps
+                              : 1;
+    Uint64        step;
+    Uint64        previous;
+    Uint64        accumulator = 0;
+    HrTimer       timer;
+    bool          fastForward = gReplay.isPlaying() && !gReplay.isRealTime();
+
+    // Le pas en battements haute résolution.
+    step     = frequency / rate;
+    gReplay.setRate( rate );
+
+    /* Temps de démarrage: à froid, les textures sont cuites depuis leurs
+    bitmaps, à chaud, elles sont projetées depuis le cache. */
+    oss << "Startup completed in "
+        << ( SDL_GetPerformanceCounter() - gStats.startupCounter ) * 1000
+         / SDL_GetPerformanceFrequency()
+        << " ms ("
+        << ( gStats.textureCacheMisses == 0 ? "warm" : "cold" )
+        << " start: "
+        << gStats.textureCacheHits
+        << " texture(s) from cache, "
+        << gStats.textureCacheMisses
+        << " cooked).";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+
+    oss.str( "" );
+    oss << "Entering main loop: fixed "
+        << timeStep
+        << " ms time step ("
+        << rate
+        << " Hz), at most "
+        << maxSteps
+        << " step(s) per frame, ";
+
+    if( fastForward )
+    {
+        oss << "unpaced (fast replay).";
+    }
+
+    else if( gFramePacer.getTargetRate() > 0 )
+    {
+        oss << "paced at "
+            << gFramePacer.getTargetRate()
+            << " fps.";
+    }
+
+    else
+    {
+        oss << "paced by vsync.";
+    }
+
+    if( gIsHeadless )
+    {
+        oss << " Headless: nothing is rendered.";
+    }
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
     gIsRunning = true;
-    gRenderTimer.start();
+    previous   = SDL_GetPerformanceCounter();
+    timer.start();
 
     // --- Boucle principale. --------------------------------------------------
     while( gIsRunning)
+    {
+        CIRION_PROFILE_FRAME();
+
+        Uint64 now     = SDL_GetPerformanceCounter();
+        Uint64 elapsed = now - previous;
+
+        previous = now;
+
+        // Durée réelle de l'image, avant l'abandon du retard.
+        gFrameStats.add( HrTimer::toNanoseconds( elapsed ) );
+
+        /* Une relecture au plus vite enchaîne un pas par image, sans
+        attente: seul compte le temps mis à les calculer. */
+        if( fastForward )
+        {
+            elapsed = step;
+        }
+
+        /* Au delà de maxSteps pas par image (fenêtre déplacée, chargement,
+        machine trop lente), le retard est abandonné plutôt que rattrapé: la
+        simulation ralentit au lieu de s'enliser. */
+        else if( elapsed > step * maxSteps )
+        {
+            gStats.simulationDropped += ( elapsed - step * maxSteps )
+                                      * 1000 / frequency;
+            elapsed = step * maxSteps;
+        }
+
+        accumulator += elapsed;
+
+        // Une image sans pas lit quand même les évenements (Échap, fenêtre).
+        if( accumulator < step )
+        {
+            handleEvents();
+        }
+
+        /* Pas fixes: la simulation est indépendante de l'affichage. Chaque
+        pas, le premier d'une image compris, relit les évenements puis
+        échantillonne les actions juste avant de s'exécuter. */
+        while( accumulator >= step )
+        {
+            handleEvents();
+            gInputSystem.sample();
+            timer.reset();
+            update( timeStep );
+            gUpdateStats.add( timer.getNanoseconds() );
+            accumulator -= step;
+            gStats.simulationTicks++;
+        }
+
+        // Rendu interpolé entre les deux derniers états, sauf sans affichage.
+        if( !gIsHeadless )
+        {
+            timer.reset();
+            render( (float)accumulator / (float)step );
+            gRenderStats.add( timer.getNanoseconds() );
+        }
+
+        gAssetWatcher.poll( gConfig.mHotReloadBudget );
+
+        /* Attente de l'image suivante. Une attente d'évenements n'est pas du
+        temps à simuler: rien n'animait. */
+        if(    !fastForward
+            && gFramePacer.wait( gConfig.mIsIdleWaitEnabled && isIdle() ) )
+        {
+            previous = SDL_GetPerformanceCounter();
+        }
+    }
+}
+
+//! @brief Procédure de simulation sans rendu, au plus vite.
+//!
+//! Les pas s'enchaînent sans render(), sans présentation ni attente: seul
+//! le coût de la simulation est mesuré, par sous-système. Les évenements
+//! restent lus (Échap interrompt), et une relecture en cours fournit les
+//! entrées.
+//! @param ticks Le nombre de pas à simuler.
+void cirion::simulate( int ticks )
+{
+    ostringstream oss;
+    FrameStats*   stats    = new FrameStats[SUBSYSTEM_COUNT];
+    int           rate     = getSimulationRate();
+    float         timeStep = 1000.0f / rate;
+    int           tick     = 0;
+    Uint64        elapsed  = 0;
+    HrTimer       timer;
+
+    oss << "Simulating "
+        << ticks
+        << " tick(s) of "
+        << timeStep
+        << " ms without rendering: "
+        << gRegistry.getCount()
+        << " object(s), "
+        << gParticleSystem.getCount()
+        << " particle(s).";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+
+    gSubsystemStats = stats;
+    gReplay.setRate( rate );
+    gIsRunning      = true;
+
+    for( tick = 0; tick != ticks && gIsRunning; tick++ )
     {
         handleEvents();
-        update( gRenderTimer.getTicks() );
-        //cout << gRenderTimer.getTicks() << endl;
-        gRenderTimer.reset();
-        render();
-        //SDL_Delay( 1 );
+        gInputSystem.sample();
+
+        timer.reset();
+        update( timeStep );
+        elapsed += timer.getNanoseconds();
+        gUpdateStats.add( timer.getNanoseconds() );
+        gStats.simulationTicks++;
+    }
+
+    gSubsystemStats = NULL;
+
+    // --- Rapport. ------------------------------------------------------------
+    oss.str( "" );
+    oss << fixed
+        << setprecision( 1 )
+        << tick
+        << " tick(s) simulated in "
+        << elapsed / 1000000.0
+        << " ms: "
+        << ( elapsed != 0 ? tick * 1000000000.0 / elapsed : 0.0 )
+        << " ticks/s, "
+        << ( elapsed != 0 ? tick * timeStep * 1000000.0 / elapsed : 0.0 )
+        << "x real time."
+        << endl
+        << gUpdateStats.getReport( "Update", false );
+
+    for( int i = 0; i != SUBSYSTEM_COUNT; i++ )
+    {
+        oss << endl
+            << stats[i].getReport( gSubsystemNames[i], false );
     }
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    delete[] stats;
 }
 
 //! @brief Procédure d'arrêt du moteur.
@@ -241,6 +757,24 @@ void cirion::quit()
 {
     log( (const char*)"Exiting cirion ...", __PRETTY_FUNCTION__ );
 
+    // Écriture ou vérification de l'enregistrement, avant la libération
+    // des objets dont il mesure les positions.
+    try
+    {
+        gReplay.stop();
+    }
+
+    catch( CiException const& e )
+    {
+        log( e );
+    }
+
+    logStats();
+    logFrameStats();
+    logPrototypes();
+    gAssetWatcher.stop();
+    gJobSystem.stop();
+
     // Liberation des objets
     for( size_t i = 0; i != gGameObjects.size(); i++ )
     {
@@ -249,6 +783,12 @@ void cirion::quit()
 
     gGameObjects.clear();
 
+    // Liberation des émetteurs de particules
+    gParticleSystem.clear();
+
+    // Liberation des prototypes, une fois leurs instances détruites.
+    freePrototypes();
+
     // Liberation des textures
     for( size_t i = 0; i != gTextures.size(); i++ )
     {
@@ -257,6 +797,12 @@ void cirion::quit()
 
     gTextures.clear();
 
+    // Liberation des tampons de pixels.
+    gPixelPool.clear();
+
+    // Écriture des derniers messages, avant l'arrêt des fils SDL2.
+    stopLogging();
+
     // Liberation des ressources de la lib. SDL2.
     SDL_DestroyWindow( gWindow );
     SDL_DestroyRenderer( gRenderer );
@@ -115,6 +115,8 @@ unsigned int cirion::Cmf::computeChecksum( fstream* file )
 //! @throw CiException en cas d'échec.
 void cirion::Cmf::load( const char* name, bool testChecksum )
 {
+    CIRION_PROFILE_ZONE( "Cmf::load" );
+
     ostringstream   oss;      //!< Un flux de chaîne pour le journal
     ostringstream   filepath; //!< Le chemin du fichier CMF
     fstream         file;     //!< Un flux de fichier
@@ -0,0 +1,418 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    collisionsystem.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Détection groupée des collisions entre sprites.
+ */
+
+#include <algorithm>
+#include <cfloat>
+#include <Cirion/collisionsystem.hpp>
+#include <Cirion/profiler.hpp>
+#include <Cirion/sprite.hpp>
+
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+
+using namespace std;
+using namespace cirion;
+
+/**
+ * Un foncteur pour trier les corps selon leurs abscisses minimales.
+ */
+struct MinXLess
+{
+    const float* minX;
+
+    bool operator()( int a, int b ) const
+    {
+        return minX[a] < minX[b];
+    }
+};
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe CollisionSystem.
+cirion::CollisionSystem::CollisionSystem():
+    mIsOrderValid( false ),
+    mStripTop    ( 0.0f ),
+    mStripHeight ( COLLISION_STRIP_HEIGHT ),
+    mStripScale  ( 1.0f / COLLISION_STRIP_HEIGHT )
+{
+}
+
+//! @brief Déstructeur pour la classe CollisionSystem.
+cirion::CollisionSystem::~CollisionSystem()
+{
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Fonction d'ajout d'un corps.
+//! @param sprite Le sprite dont la position est relue à chaque mise à jour,
+//!               ou NULL pour un corps positionné par setPosition().
+//! @param hitbox La hitbox, relative à la position.
+//! @return La poignée du corps.
+int cirion::CollisionSystem::add( Sprite* sprite, const SDL_Rect& hitbox )
+{
+    int handle;
+
+    if( !mFreeHandles.empty() )
+    {
+        handle = mFreeHandles.back();
+        mFreeHandles.pop_back();
+    }
+
+    else
+    {
+        handle = (int)mIndices.size();
+        mIndices.push_back( -1 );
+    }
+
+    mIndices[handle] = (int)mSprites.size();
+
+    mSprites.push_back( sprite );
+    mHitboxes.push_back( hitbox );
+    mMinX.push_back( 0.0f );
+    mMinY.push_back( 0.0f );
+    mMaxX.push_back( 0.0f );
+    mMaxY.push_back( 0.0f );
+    mHandles.push_back( handle );
+
+    setPosition( handle, Point2f( 0.0f, 0.0f ) );
+    mIsOrderValid = false;
+
+    return handle;
+}
+
+//! @brief Procédure de retrait d'un corps.
+//! @param handle La poignée du corps.
+void cirion::CollisionSystem::remove( int handle )
+{
+    size_t i    = (size_t)mIndices[handle];
+    size_t last = mSprites.size() - 1;
+
+    if( i != last )
+    {
+        mSprites[i]  = mSprites[last];
+        mHitboxes[i] = mHitboxes[last];
+        mMinX[i]     = mMinX[last];
+        mMinY[i]     = mMinY[last];
+        mMaxX[i]     = mMaxX[last];
+        mMaxY[i]     = mMaxY[last];
+        mHandles[i]  = mHandles[last];
+
+        mIndices[mHandles[i]] = (int)i;
+    }
+
+    mSprites.pop_back();
+    mHitboxes.pop_back();
+    mMinX.pop_back();
+    mMinY.pop_back();
+    mMaxX.pop_back();
+    mMaxY.pop_back();
+    mHandles.pop_back();
+
+    mIndices[handle] = -1;
+    mFreeHandles.push_back( handle );
+    mIsOrderValid = false;
+    // Les contacts en cours peuvent désigner le corps retiré.
+    mContacts.clear();
+}
+
+//! @brief Procédure de retrait de tous les corps.
+void cirion::CollisionSystem::clear()
+{
+    mSprites.clear();
+    mHitboxes.clear();
+    mMinX.clear();
+    mMinY.clear();
+    mMaxX.clear();
+    mMaxY.clear();
+    mOrder.clear();
+    mContacts.clear();
+    mHandles.clear();
+    mIndices.clear();
+    mFreeHandles.clear();
+    mIsOrderValid = false;
+}
+
+//! @brief Procédure de détection des contacts de la mise à jour.
+//!
+//! Les positions des sprites suivis sont relues, puis les contacts sont
+//! recalculés: getContacts() les rend jusqu'à la mise à jour suivante.
+void cirion::CollisionSystem::update()
+{
+    CIRION_PROFILE_ZONE( "CollisionSystem::update" );
+
+    for( size_t i = 0; i != mSprites.size(); i++ )
+    {
+        if( mSprites[i] != NULL )
+        {
+            setPosition( mHandles[i], mSprites[i]->getPosition() );
+        }
+    }
+
+    sort();
+    buildStrips();
+    sweep();
+}
+
+//! @brief Procédure de changement de la hitbox d'un corps.
+//! @param handle La poignée du corps.
+//! @param hitbox La hitbox, relative à la position.
+void cirion::CollisionSystem::setHitbox( int handle, const SDL_Rect& hitbox )
+{
+    mHitboxes[mIndices[handle]] = hitbox;
+}
+
+//! @brief Procédure de placement d'un corps.
+//! @param handle La poignée du corps.
+//! @param position La position, à laquelle la hitbox est relative.
+void cirion::CollisionSystem::setPosition( int handle, const Point2f& position )
+{
+    size_t          i      = (size_t)mIndices[handle];
+    const SDL_Rect& hitbox = mHitboxes[i];
+
+    mMinX[i] = position.mX + hitbox.x;
+    mMinY[i] = position.mY + hitbox.y;
+    mMaxX[i] = mMinX[i] + hitbox.w;
+    mMaxY[i] = mMinY[i] + hitbox.h;
+}
+
+//! @brief Fonction accesseur.
+//! @param handle La poignée du corps.
+//! @return Le sprite suivi, ou NULL.
+Sprite* cirion::CollisionSystem::getSprite( int handle )
+{
+    return mSprites[mIndices[handle]];
+}
+
+//! @brief Fonction accesseur.
+//! @return Les contacts de la dernière mise à jour.
+const vector<Contact>& cirion::CollisionSystem::getContacts()
+{
+    return mContacts;
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre de corps.
+size_t cirion::CollisionSystem::getCount()
+{
+    return mSprites.size();
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées.                                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de tri des corps selon leurs abscisses minimales.
+//!
+//! L'ordre précédent est presque trié: un tri par insertion s'en approche
+//! du linéaire. Après un ajout ou un retrait, l'ordre est reconstruit.
+void cirion::CollisionSystem::sort()
+{
+    size_t count = mSprites.size();
+
+    if( !mIsOrderValid || mOrder.size() != count )
+    {
+        MinXLess less;
+
+        less.minX = count != 0 ? &mMinX[0] : NULL;
+        mOrder.resize( count );
+
+        for( size_t i = 0; i != count; i++ )
+        {
+            mOrder[i] = (int)i;
+        }
+
+        std::sort( mOrder.begin(), mOrder.end(), less );
+        mIsOrderValid = true;
+        return;
+    }
+
+    for( size_t i = 1; i < count; i++ )
+    {
+        int    index = mOrder[i];
+        float  minX  = mMinX[index];
+        size_t j     = i;
+
+        for( ; j != 0 && mMinX[mOrder[j - 1]] > minX; j-- )
+        {
+            mOrder[j] = mOrder[j - 1];
+        }
+
+        mOrder[j] = index;
+    }
+}
+
+//! @brief Procédure de répartition des corps dans les bandes horizontales.
+//!
+//! Un corps figure dans chaque bande qu'il recouvre. La répartition suit
+//! l'ordre du tri: chaque bande est donc triée selon les abscisses.
+void cirion::CollisionSystem::buildStrips()
+{
+    size_t count = mSprites.size();
+    float  top    =  FLT_MAX;
+    float  bottom = -FLT_MAX;
+    int    stripCount;
+    int    total;
+
+    for( size_t i = 0; i != count; i++ )
+    {
+        top    = mMinY[i] < top    ? mMinY[i] : top;
+        bottom = mMaxY[i] > bottom ? mMaxY[i] : bottom;
+    }
+
+    mStripTop    = count != 0 ? top : 0.0f;
+    mStripHeight = COLLISION_STRIP_HEIGHT;
+
+    // Des corps très éloignés ne doivent pas multiplier les bandes vides.
+    while( count != 0 && ( bottom - top ) / mStripHeight > 4.0f * count + 16 )
+    {
+        mStripHeight *= 2.0f;
+    }
+
+    mStripScale = 1.0f / mStripHeight;
+    stripCount  = count != 0 ? getStrip( bottom ) + 1 : 0;
+
+    // Comptage, puis répartition stable.
+    mStripStarts.assign( stripCount + 1, 0 );
+    mFirstStrips.resize( count );
+    mLastStrips.resize( count );
+
+    for( size_t i = 0; i != count; i++ )
+    {
+        mFirstStrips[i] = getStrip( mMinY[i] );
+        mLastStrips[i]  = getStrip( mMaxY[i] );
+
+        for( int s = mFirstStrips[i]; s <= mLastStrips[i]; s++ )
+        {
+            mStripStarts[s + 1]++;
+        }
+    }
+
+    for( int s = 0; s != stripCount; s++ )
+    {
+        mStripStarts[s + 1] += mStripStarts[s];
+    }
+
+    total = mStripStarts[stripCount];
+    mStripCursors.assign( mStripStarts.begin(), mStripStarts.end() );
+    mStripBodies.resize( total );
+    mStripBoxes.resize( total );
+
+    for( size_t k = 0; k != count; k++ )
+    {
+        int          index = mOrder[k];
+        CollisionBox box;
+
+        box.v[0] =  mMinX[index];
+        box.v[1] =  mMinY[index];
+        box.v[2] = -mMaxX[index];
+        box.v[3] = -mMaxY[index];
+
+        for( int s = mFirstStrips[index]; s <= mLastStrips[index]; s++ )
+        {
+            int entry = mStripCursors[s]++;
+
+            mStripBodies[entry] = index;
+            mStripBoxes[entry]  = box;
+        }
+    }
+}
+
+//! @brief Procédure de balayage des bandes.
+//!
+//! Pour chaque boîte d'une bande, les suivantes sont parcourues tant que
+//! leur abscisse minimale reste sous son abscisse maximale. Les bords qui se
+//! touchent ne sont pas un contact. Une paire présente dans plusieurs bandes
+//! n'est retenue que dans celle où commence leur recouvrement.
+void cirion::CollisionSystem::sweep()
+{
+    int stripCount = (int)mStripStarts.size() - 1;
+
+    mContacts.clear();
+
+    for( int s = 0; s < stripCount; s++ )
+    {
+        int end = mStripStarts[s + 1];
+
+        for( int i = mStripStarts[s]; i < end; i++ )
+        {
+            const float* a = mStripBoxes[i].v;
+
+            #ifdef __SSE2__
+            // ( maxX, maxY, -minX, -minY ), dans l'ordre inverse de _mm_set_ps.
+            __m128 bound = _mm_set_ps( -a[1], -a[0], -a[3], -a[2] );
+            #endif // __SSE2__
+
+            for( int j = i + 1; j < end; j++ )
+            {
+                const float* b = mStripBoxes[j].v;
+
+                #ifdef __SSE2__
+                int mask = _mm_movemask_ps(
+                           _mm_cmplt_ps( _mm_loadu_ps( b ), bound ) );
+                #else
+                int mask = ( b[0] < -a[2] )
+                         | ( b[1] < -a[3] ) << 1
+                         | ( b[2] < -a[0] ) << 2
+                         | ( b[3] < -a[1] ) << 3;
+                #endif // __SSE2__
+
+                // Les abscisses étant triées, la suite de la bande est hors
+                // d'atteinte.
+                if( ( mask & 1 ) == 0 )
+                {
+                    break;
+                }
+
+                if(    mask == 0xF
+                    && getStrip( a[1] > b[1] ? a[1] : b[1] ) == s )
+                {
+                    Contact contact;
+
+                    contact.first  = mHandles[mStripBodies[i]];
+                    contact.second = mHandles[mStripBodies[j]];
+                    mContacts.push_back( contact );
+                }
+            }
+        }
+    }
+}
+
+//! @brief Fonction de calcul de la bande d'une ordonnée.
+//! @param y L'ordonnée, dans l'étendue des corps.
+//! @return L'indice de la bande.
+int cirion::CollisionSystem::getStrip( float y )
+{
+    return (int)( ( y - mStripTop ) * mStripScale );
+}
@@ -44,7 +44,23 @@ cirion::Config::Config() :
     mWindowHeight( 480 ),
     mIsFullscreen( false ),
     mIsHwRenderEnabled( true ),
-    mIsVsyncEnabled( true )
+    mIsVsyncEnabled( true ),
+    #ifdef DEBUG
+    mIsHotReloadEnabled( true ),
+    #else
+    mIsHotReloadEnabled( false ),
+    #endif // DEBUG
+    mHotReloadBudget( 2 ),
+    mTextureBudget( 64 ),
+    mIsTextureCacheEnabled( true ),
+    mJobThreads( 0 ),
+    mSimulationRate( 100 ),
+    mMaxSimulationSteps( 5 ),
+    mTargetFps( 0 ),
+    mIsIdleWaitEnabled( true ),
+    mIdleTimeout( 100 ),
+    mIsOverlayVisible( false ),
+    mIsLatencyMeasured( false )
 {
     mKeyboardMap.up    = SDLK_z;
     mKeyboardMap.down  = SDLK_s;
@@ -63,6 +79,13 @@ void cirion::Config::load( const char* filepath )
     tinyxml2::XMLElement* configNode;
     tinyxml2::XMLElement* windowNode;
     tinyxml2::XMLElement* rendererNode;
+    tinyxml2::XMLElement* hotReloadNode;
+    tinyxml2::XMLElement* texturesNode;
+    tinyxml2::XMLElement* jobsNode;
+    tinyxml2::XMLElement* simulationNode;
+    tinyxml2::XMLElement* pacingNode;
+    tinyxml2::XMLElement* overlayNode;
+    tinyxml2::XMLElement* inputNode;
     tinyxml2::XMLElement* keymapNode;
     tinyxml2::XMLElement* upNode;
     tinyxml2::XMLElement* downNode;
@@ -70,6 +93,7 @@ void cirion::Config::load( const char* filepath )
     tinyxml2::XMLElement* rightNode;
     tinyxml2::XMLElement* jumpNode;
     tinyxml2::XMLElement* fireNode;
+    int                   rate = mSimulationRate;
 
     // --- Ouverture du fichier XML. -------------------------------------------
     if( xml.LoadFile( filepath ) != XML_NO_ERROR )
@@ -108,6 +132,73 @@ void cirion::Config::load( const char* filepath )
             rendererNode->QueryBoolAttribute( "vsync", &mIsVsyncEnabled    );
         }
 
+        // --- Récuperation du neud <hotreload>. -------------------------------
+        hotReloadNode = configNode->FirstChildElement( "hotreload" );
+
+        if( hotReloadNode != NULL )
+        {
+            hotReloadNode->QueryBoolAttribute( "enabled", &mIsHotReloadEnabled );
+            hotReloadNode->QueryIntAttribute ( "budget" , &mHotReloadBudget    );
+        }
+
+        // --- Récuperation du neud <textures>. --------------------------------
+        texturesNode = configNode->FirstChildElement( "textures" );
+
+        if( texturesNode != NULL )
+        {
+            texturesNode->QueryIntAttribute ( "budget", &mTextureBudget         );
+            texturesNode->QueryBoolAttribute( "cache" , &mIsTextureCacheEnabled );
+        }
+
+        // --- Récuperation du neud <jobs>. ------------------------------------
+        jobsNode = configNode->FirstChildElement( "jobs" );
+
+        if( jobsNode != NULL )
+        {
+            jobsNode->QueryIntAttribute( "threads", &mJobThreads );
+        }
+
+        // --- Récuperation du neud <simulation>. ------------------------------
+        simulationNode = configNode->FirstChildElement( "simulation" );
+
+        if( simulationNode != NULL )
+        {
+            simulationNode->QueryIntAttribute( "rate"    , &rate                );
+            simulationNode->QueryIntAttribute( "maxsteps", &mMaxSimulationSteps );
+
+            // Une fréquence nulle ou négative n'avancerait jamais: refusée.
+            if( rate > 0 )
+            {
+                mSimulationRate = rate;
+            }
+        }
+
+        // --- Récuperation du neud <pacing>. ----------------------------------
+        pacingNode = configNode->FirstChildElement( "pacing" );
+
+        if( pacingNode != NULL )
+        {
+            pacingNode->QueryIntAttribute ( "fps"    , &mTargetFps         );
+            pacingNode->QueryBoolAttribute( "idle"   , &mIsIdleWaitEnabled );
+            pacingNode->QueryIntAttribute ( "timeout", &mIdleTimeout       );
+        }
+
+        // --- Récuperation du neud <overlay>. ---------------------------------
+        overlayNode = configNode->FirstChildElement( "overlay" );
+
+        if( overlayNode != NULL )
+        {
+            overlayNode->QueryBoolAttribute( "visible", &mIsOverlayVisible );
+        }
+
+        // --- Récuperation du neud <input>. -----------------------------------
+        inputNode = configNode->FirstChildElement( "input" );
+
+        if( inputNode != NULL )
+        {
+            inputNode->QueryBoolAttribute( "latency", &mIsLatencyMeasured );
+        }
+
         // --- Récuperation du neud <keymap>. ----------------------------------
         keymapNode = configNode->FirstChildElement( "keymap" );
 
@@ -162,6 +253,22 @@ void cirion::Config::load( const char* filepath )
             }
         }
     }
+
+    // --- Validation. ---------------------------------------------------------
+    if( rate <= 0 )
+    {
+        ostringstream oss;
+
+        oss << "Invalid simulation rate of "
+            << rate
+            << " Hz in \""
+            << filepath
+            << "\": using "
+            << mSimulationRate
+            << " Hz instead.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
 }
 
 //! @brief Procédure d'écriture du fichier de configuration sur le disque.
@@ -0,0 +1,476 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file    cookedtexture.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Cache de textures précuites.
+ */
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/cookedtexture.hpp>
+#include <Cirion/log.hpp>
+#include <Cirion/surface.hpp>
+
+#ifdef _WIN32
+    #include <direct.h> // _mkdir()
+#else
+    #include <fcntl.h>    // open()
+    #include <sys/mman.h> // mmap(), munmap()
+    #include <sys/stat.h> // fstat(), mkdir()
+    #include <unistd.h>   // close()
+#endif
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe CookedTexture.
+cirion::CookedTexture::CookedTexture():
+    mPixels     ( NULL ),
+    mMapping    ( NULL ),
+    mMappingSize( 0 ),
+    mBuffer     ( NULL ),
+    mBufferSize ( 0 )
+{
+    memset( &mHeader, 0x00, sizeof(CtxHeader) );
+}
+
+//! @brief Déstructeur pour la classe CookedTexture.
+cirion::CookedTexture::~CookedTexture()
+{
+    clear();
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de chargement d'une texture précuite.
+//! @param filepath Chemin vers le fichier.
+//! @throw CiException en cas d'échec.
+void cirion::CookedTexture::load( const char* filepath )
+{
+    ostringstream oss;
+    size_t        size = 0;
+
+    clear();
+
+    #ifdef _WIN32
+
+    // --- Lecture du fichier en mémoire. --------------------------------------
+    ifstream file( filepath, ios::binary | ios::in );
+
+    if( file.is_open() )
+    {
+        file.seekg( 0, ios::end );
+        size = (size_t)file.tellg();
+        file.seekg( 0, ios::beg );
+
+        if( size != 0 )
+        {
+            mBuffer     = (Uint8*)gPixelPool.acquire( size );
+            mBufferSize = mBuffer != NULL ? size : 0;
+        }
+
+        if( mBuffer != NULL )
+        {
+            file.read( (char*)mBuffer, size );
+        }
+
+        file.close();
+    }
+
+    const Uint8* data = mBuffer;
+
+    #else
+
+    // --- Projection du fichier en mémoire. -----------------------------------
+    int         fd = open( filepath, O_RDONLY );
+    struct stat st;
+
+    if( fd != -1 && fstat( fd, &st ) == 0 && st.st_size > 0 )
+    {
+        size     = (size_t)st.st_size;
+        mMapping = mmap( NULL, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+
+        if( mMapping == MAP_FAILED )
+        {
+            mMapping = NULL;
+        }
+
+        else
+        {
+            mMappingSize = size;
+        }
+    }
+
+    if( fd != -1 )
+    {
+        close( fd );
+    }
+
+    const Uint8* data = (const Uint8*)mMapping;
+
+    #endif // _WIN32
+
+    if( data == NULL )
+    {
+        oss << "Unable to load cooked texture \""
+            << filepath
+            << "\": file not found.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    // --- Lecture et vérification de l'en-tête. -------------------------------
+    if( size < sizeof(CtxHeader) )
+    {
+        clear();
+
+        oss << "Unable to load cooked texture \""
+            << filepath
+            << "\": truncated header.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    memcpy( &mHeader, data, sizeof(CtxHeader) );
+
+    if( mHeader.magic != CTX_MAGIC || mHeader.version != CTX_VERSION )
+    {
+        clear();
+
+        oss << "Unable to load cooked texture \""
+            << filepath
+            << "\": wrong magic or version.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    if(    mHeader.width <= 0 || mHeader.height <= 0
+        || mHeader.pitch < mHeader.width * 4
+        || size < sizeof(CtxHeader)
+                + (size_t)mHeader.pitch * (size_t)mHeader.height )
+    {
+        clear();
+
+        oss << "Unable to load cooked texture \""
+            << filepath
+            << "\": truncated pixel data.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    mPixels = data + sizeof(CtxHeader);
+}
+
+//! @brief Procédure de cuisson d'une surface: conversion déjà faite par la
+//!        surface, application de la couleur clé et mise en forme du fichier.
+//! @param surface La surface source, au format 32 bits RGBA.
+//! @param sourceHash L'empreinte du bitmap source.
+//! @throw CiException en cas d'échec.
+void cirion::CookedTexture::cook( Surface* surface, Uint32 sourceHash )
+{
+    SDL_Surface* sdlSurface = surface->getSdl2Surface();
+
+    if( sdlSurface == NULL || sdlSurface->format->BytesPerPixel != 4 )
+    {
+        throw CiException( "Unable to cook texture: expected a 32-bit surface.",
+            __PRETTY_FUNCTION__ );
+    }
+
+    clear();
+
+    // --- Construction de l'en-tête. ------------------------------------------
+    mHeader.magic      = CTX_MAGIC;
+    mHeader.version    = CTX_VERSION;
+    mHeader.sourceHash = sourceHash;
+    mHeader.format     = sdlSurface->format->format;
+    mHeader.width      = sdlSurface->w;
+    mHeader.height     = sdlSurface->h;
+    mHeader.pitch      = sdlSurface->w * 4;
+    mHeader.reserved   = 0;
+
+    mBufferSize = sizeof(CtxHeader)
+                + (size_t)mHeader.pitch * (size_t)mHeader.height;
+    mBuffer     = (Uint8*)gPixelPool.acquire( mBufferSize );
+
+    if( mBuffer == NULL )
+    {
+        mBufferSize = 0;
+
+        throw CiException( "Unable to cook texture: out of memory.",
+            __PRETTY_FUNCTION__ );
+    }
+
+    memcpy( mBuffer, &mHeader, sizeof(CtxHeader) );
+
+    // --- Copie des pixels et application du pixel transparent. ---------------
+
+    /* Même couleur clé que Texture::create( Surface* ): le noir opaque devient
+    le pixel transparent. */
+    Uint32 colorKey    = SDL_MapRGBA( sdlSurface->format, 0x00, 0x00, 0x00, 0xFF );
+    Uint32 transparent = SDL_MapRGBA( sdlSurface->format, 0x00, 0x00, 0x00, 0x00 );
+
+    SDL_LockSurface( sdlSurface );
+
+    for( int y = 0; y != mHeader.height; y++ )
+    {
+        const Uint32* src = (const Uint32*)( (const Uint8*)sdlSurface->pixels
+                                             + y * sdlSurface->pitch );
+        Uint32*       dst = (Uint32*)( mBuffer + sizeof(CtxHeader)
+                                       + y * mHeader.pitch );
+
+        for( int x = 0; x != mHeader.width; x++ )
+        {
+            dst[x] = src[x] == colorKey ? transparent : src[x];
+        }
+    }
+
+    SDL_UnlockSurface( sdlSurface );
+
+    mPixels = mBuffer + sizeof(CtxHeader);
+}
+
+//! @brief Procédure d'écriture de la texture précuite sur le disque.
+//! @param filepath Chemin vers le fichier.
+//! @throw CiException en cas d'échec.
+void cirion::CookedTexture::write( const char* filepath )
+{
+    ostringstream oss;
+    string        directory( filepath );
+    fstream       file;
+
+    if( mBuffer == NULL )
+    {
+        throw CiException( "Unable to write cooked texture: nothing cooked.",
+            __PRETTY_FUNCTION__ );
+    }
+
+    // --- Création du répertoire du cache, si besoin. -------------------------
+    if( directory.find_last_of( '/' ) != string::npos )
+    {
+        directory.erase( directory.find_last_of( '/' ) );
+
+        #ifdef _WIN32
+            _mkdir( directory.c_str() );
+        #else
+            mkdir( directory.c_str(), 0755 );
+        #endif
+    }
+
+    // --- Ecriture du fichier. ------------------------------------------------
+    file.open( filepath, ios::binary | ios::out | ios::trunc );
+
+    if( !file.is_open() )
+    {
+        oss << "Unable to write cooked texture \""
+            << filepath
+            << "\": unable to create output file.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    file.write( (const char*)mBuffer, mBufferSize );
+    file.close();
+}
+
+//! @brief Procédure de libération des pixels et de la projection.
+void cirion::CookedTexture::clear()
+{
+    #ifndef _WIN32
+
+    if( mMapping != NULL )
+    {
+        munmap( mMapping, mMappingSize );
+    }
+
+    #endif // _WIN32
+
+    mMapping     = NULL;
+    mMappingSize = 0;
+    mPixels      = NULL;
+
+    if( mBuffer != NULL )
+    {
+        gPixelPool.release( mBuffer, mBufferSize );
+    }
+
+    mBuffer     = NULL;
+    mBufferSize = 0;
+    memset( &mHeader, 0x00, sizeof(CtxHeader) );
+}
+
+//! @brief Fonction de calcul du rectangle englobant les pixels modifiés.
+//! @param previous Les pixels précédents.
+//! @param rect Le rectangle calculé, de largeur nulle si aucun pixel n'a
+//! changé.
+//! @return Faux si les deux textures n'ont pas le même format ou les mêmes
+//! dimensions: rien n'est calculé.
+bool cirion::CookedTexture::diff( CookedTexture& previous, SDL_Rect* rect )
+{
+    const Uint8* before = (const Uint8*)previous.getPixels();
+    const Uint8* after  = mPixels;
+    int          width  = mHeader.width;
+    int          height = mHeader.height;
+    int          pitch  = mHeader.pitch;
+    int          right  = -1;
+    int          bottom = -1;
+
+    if(    before == NULL
+        || after  == NULL
+        || previous.getFormat() != mHeader.format
+        || previous.getWidth()  != width
+        || previous.getHeight() != height
+        || previous.getPitch()  != pitch )
+    {
+        return false;
+    }
+
+    rect->x = width;
+    rect->y = height;
+
+    for( int y = 0; y != height; y++ )
+    {
+        const Uint32* rowBefore = (const Uint32*)( before + y * pitch );
+        const Uint32* rowAfter  = (const Uint32*)( after  + y * pitch );
+
+        if( memcmp( rowBefore, rowAfter, width * 4 ) == 0 )
+        {
+            continue;
+        }
+
+        rect->y = rect->y < y ? rect->y : y;
+        bottom  = y;
+
+        for( int x = 0; x != width; x++ )
+        {
+            if( rowBefore[x] != rowAfter[x] )
+            {
+                rect->x = rect->x < x ? rect->x : x;
+                right   = right   > x ? right   : x;
+            }
+        }
+    }
+
+    if( bottom == -1 )
+    {
+        rect->x = 0;
+        rect->y = 0;
+        rect->w = 0;
+        rect->h = 0;
+    }
+
+    else
+    {
+        rect->w = right  - rect->x + 1;
+        rect->h = bottom - rect->y + 1;
+    }
+
+    return true;
+}
+
+//! @brief Fonction accesseur.
+//! @return L'empreinte du bitmap depuis lequel la texture a été cuite.
+Uint32 cirion::CookedTexture::getSourceHash()
+{
+    return mHeader.sourceHash;
+}
+
+//! @brief Fonction accesseur.
+//! @return Le format des pixels.
+Uint32 cirion::CookedTexture::getFormat()
+{
+    return mHeader.format;
+}
+
+//! @brief Fonction accesseur.
+//! @return La largeur de la texture, en pixels.
+int cirion::CookedTexture::getWidth()
+{
+    return mHeader.width;
+}
+
+//! @brief Fonction accesseur.
+//! @return La hauteur de la texture, en pixels.
+int cirion::CookedTexture::getHeight()
+{
+    return mHeader.height;
+}
+
+//! @brief Fonction accesseur.
+//! @return La longueur en octet d'une rangée de pixels.
+int cirion::CookedTexture::getPitch()
+{
+    return mHeader.pitch;
+}
+
+//! @brief Fonction accesseur.
+//! @return Pointeur vers les pixels.
+const void* cirion::CookedTexture::getPixels()
+{
+    return mPixels;
+}
+
+//! @brief Fonction de calcul de l'empreinte (FNV-1a 32 bits) d'un fichier.
+//! @param filepath Chemin vers le fichier.
+//! @return L'empreinte calculée.
+//! @throw CiException en cas d'échec.
+Uint32 cirion::CookedTexture::computeSourceHash( const char* filepath )
+{
+    ifstream file( filepath, ios::binary | ios::in );
+    char     buffer[4096];
+    Uint32   hash = 2166136261u;
+
+    if( !file.is_open() )
+    {
+        ostringstream oss;
+
+        oss << "Unable to hash \""
+            << filepath
+            << "\": file not found.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    while( file )
+    {
+        file.read( buffer, sizeof(buffer) );
+
+        for( streamsize i = 0; i != file.gcount(); i++ )
+        {
+            hash ^= (Uint8)buffer[i];
+            hash *= 16777619u;
+        }
+    }
+
+    return hash;
+}
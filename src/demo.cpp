@@ -26,16 +26,19 @@
  * @brief   Demo.
  */
 
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <vector>
+#include <Cirion/bench.hpp>
 #include <Cirion/ciexception.hpp>
 #include <Cirion/cirion.hpp>
 #include <Cirion/gameobject.hpp>
 #include <Cirion/graphic.hpp>
 #include <Cirion/hiro.hpp>
-#include <Cirion/introbubble.hpp>
 #include <Cirion/log.hpp>
+#include <Cirion/spritetrim.hpp>
 #include <Cirion/world.hpp>
 
 using namespace std;
@@ -46,27 +49,247 @@ int main( int argc, char* argv[] )
     // Définition du chemin des ressources.
     gWorkingDir = (char*)"./Data";
 
+    // Outil hors ligne: rognage des images des entités données.
+    if( argc > 2 && strcmp( argv[1], "--trim" ) == 0 )
+    {
+        int status = 0;
+
+        SDL_Init( SDL_INIT_VIDEO );
+
+        for( int i = 2; i != argc; i++ )
+        {
+            try
+            {
+                trimEntity( argv[i] );
+            }
+
+            catch( CiException const& e )
+            {
+                log( e );
+                status = -1;
+            }
+        }
+
+        SDL_Quit();
+        return status;
+    }
+
+    // Mesure du chargement d'un niveau: --bench load <cmf> <itérations>.
+    if( argc > 4 && strcmp( argv[1], "--bench" ) == 0
+        && strcmp( argv[2], "load" ) == 0 )
+    {
+        int status = 0;
+
+        try
+        {
+            init();
+            benchLevelLoad( argv[3], atoi( argv[4] ) );
+        }
+
+        catch( CiException const& e )
+        {
+            log( e );
+            status = -1;
+        }
+
+        quit();
+        return status;
+    }
+
+    // Mesure des animations: --bench animations <sprites> [mises à jour].
+    if( argc > 3 && strcmp( argv[1], "--bench" ) == 0
+        && strcmp( argv[2], "animations" ) == 0 )
+    {
+        benchAnimations( atoi( argv[3] ), argc > 4 ? atoi( argv[4] ) : 600 );
+        return 0;
+    }
+
+    // Mesure des collisions: --bench collisions <corps> [mises à jour].
+    if( argc > 3 && strcmp( argv[1], "--bench" ) == 0
+        && strcmp( argv[2], "collisions" ) == 0 )
+    {
+        benchCollisions( atoi( argv[3] ), argc > 4 ? atoi( argv[4] ) : 600 );
+        return 0;
+    }
+
+    // Mesure des objets: --bench objects <objets> [mises à jour].
+    if( argc > 3 && strcmp( argv[1], "--bench" ) == 0
+        && strcmp( argv[2], "objects" ) == 0 )
+    {
+        benchObjects( atoi( argv[3] ), argc > 4 ? atoi( argv[4] ) : 600 );
+        return 0;
+    }
+
+    // Mesure des allocations: --bench spawn <sprites> [mises à jour].
+    if( argc > 3 && strcmp( argv[1], "--bench" ) == 0
+        && strcmp( argv[2], "spawn" ) == 0 )
+    {
+        benchSpawn( atoi( argv[3] ), argc > 4 ? atoi( argv[4] ) : 600 );
+        return 0;
+    }
+
+    // Mesure des particules: --bench particles <particules> [mises à jour].
+    if( argc > 3 && strcmp( argv[1], "--bench" ) == 0
+        && strcmp( argv[2], "particles" ) == 0 )
+    {
+        benchParticles( atoi( argv[3] ), argc > 4 ? atoi( argv[4] ) : 600 );
+        return 0;
+    }
+
+    // Mesure de la répartition: --bench jobs <particules> [mises à jour].
+    if( argc > 3 && strcmp( argv[1], "--bench" ) == 0
+        && strcmp( argv[2], "jobs" ) == 0 )
+    {
+        benchJobs( atoi( argv[3] ), argc > 4 ? atoi( argv[4] ) : 600 );
+        return 0;
+    }
+
+    // Mesure de la cadence: --bench pacing <images> [travail en us].
+    if( argc > 3 && strcmp( argv[1], "--bench" ) == 0
+        && strcmp( argv[2], "pacing" ) == 0 )
+    {
+        benchPacing( atoi( argv[3] ), argc > 4 ? atoi( argv[4] ) : 2000 );
+        return 0;
+    }
+
+    // Mesure du journal: --bench log <messages>.
+    if( argc > 3 && strcmp( argv[1], "--bench" ) == 0
+        && strcmp( argv[2], "log" ) == 0 )
+    {
+        benchLog( atoi( argv[3] ) );
+        return 0;
+    }
+
+    /* Mesure de la simulation sans rendu: --bench simulation <cmf>
+    [personnages] [particules] [pas] [--replay <fichier>]. */
+    if( argc > 3 && strcmp( argv[1], "--bench" ) == 0
+        && strcmp( argv[2], "simulation" ) == 0 )
+    {
+        int status = 0;
+
+        gIsHeadless = true;
+        SDL_SetHint( SDL_HINT_RENDER_VSYNC, "0" );
+
+        try
+        {
+            init();
+
+            for( int i = 4; i + 1 < argc; i++ )
+            {
+                if( strcmp( argv[i], "--replay" ) == 0 )
+                {
+                    gReplay.play( argv[i + 1], false );
+                }
+            }
+
+            benchSimulation( argv[3],
+                             argc > 4 && argv[4][0] != '-' ? atoi( argv[4] ) : 1,
+                             argc > 5 && argv[5][0] != '-' ? atoi( argv[5] ) : 0,
+                             argc > 6 && argv[6][0] != '-' ? atoi( argv[6] ) : 6000 );
+        }
+
+        catch( CiException const& e )
+        {
+            log( e );
+            status = -1;
+        }
+
+        quit();
+        return status;
+    }
+
+    // Mesure des déplacements: --bench tiles <corps> [mises à jour].
+    if( argc > 3 && strcmp( argv[1], "--bench" ) == 0
+        && strcmp( argv[2], "tiles" ) == 0 )
+    {
+        try
+        {
+            benchTiles( atoi( argv[3] ), argc > 4 ? atoi( argv[4] ) : 600 );
+        }
+
+        catch( CiException const& e )
+        {
+            log( e );
+            return -1;
+        }
+
+        return 0;
+    }
+
+    /* Options de la partie: --record <fichier>, --replay <fichier>
+    [--realtime] [--headless], --trace <images>. */
+    const char* recordPath  = NULL;
+    const char* replayPath  = NULL;
+    bool        isRealTime  = false;
+    int         traceFrames = 0;
+
+    for( int i = 1; i != argc; i++ )
+    {
+        if( strcmp( argv[i], "--record" ) == 0 && i + 1 != argc )
+        {
+            recordPath = argv[++i];
+        }
+
+        else if( strcmp( argv[i], "--replay" ) == 0 && i + 1 != argc )
+        {
+            replayPath = argv[++i];
+        }
+
+        else if( strcmp( argv[i], "--trace" ) == 0 && i + 1 != argc )
+        {
+            traceFrames = atoi( argv[++i] );
+        }
+
+        else if( strcmp( argv[i], "--realtime" ) == 0 )
+        {
+            isRealTime = true;
+        }
+
+        else if( strcmp( argv[i], "--headless" ) == 0 )
+        {
+            gIsHeadless = true;
+        }
+    }
+
+    // Une relecture au plus vite n'attend pas la synchronisation verticale.
+    if( replayPath != NULL && !isRealTime )
+    {
+        SDL_SetHint( SDL_HINT_RENDER_VSYNC, "0" );
+    }
+
     try
     {
         // Initialisation
         init();
 
+        // Graines et entrées: avant la création du monde et des objets.
+        if( replayPath != NULL )
+        {
+            gReplay.play( replayPath, isRealTime );
+        }
+
+        else if( recordPath != NULL )
+        {
+            gReplay.record( recordPath );
+        }
+
         // Création du monde
-        gWorld.create( (const char*)"0" );
+        gWorld.create( (const char*)"Test1" );
 
         // Géneration du champ de bulles
-        /*for( size_t i = 0; i != 250; i++ )
-        {
-            IntroBubble* bubble = new IntroBubble();
-            bubble->create();
-            gGameObjects.push_back( bubble );
-        }*/
+        //gParticleSystem.add( "Bubbles" );
 
         // Création du personnage
         Hiro* hiro = new Hiro();
         hiro->create( "DummyAlt" );
-        hiro->setPosition( Point2f( 144.0f, 102.0f ) );
+        hiro->warp( Point2f( 144.0f, 102.0f ) );
         gGameObjects.push_back( hiro );
+
+        // Trace des premières images
+        if( traceFrames > 0 )
+        {
+            gProfiler.capture( traceFrames, "trace.json" );
+        }
     }
 
     catch( CiException const& e )
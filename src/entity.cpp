@@ -27,19 +27,21 @@
  */
 
 #include <sstream>
-#include <tinyxml2.h>
+#include <string>
+#include <vector>
 #include <Cirion/ciexception.hpp>
 #include <Cirion/cirion.hpp>
 #include <Cirion/entity.hpp>
+#include <Cirion/log.hpp>
 #include <Cirion/point2.hpp>
-#include <Cirion/xmlerror.hpp>
 
 using namespace cirion;
 using namespace std;
-using namespace tinyxml2;
 
 //! @brief Constructeur pour la classe Entity.
-cirion::Entity::Entity()
+cirion::Entity::Entity():
+    mPrototype ( NULL ),
+    mStateFlags( 0 )
 {
 }
 
@@ -50,103 +52,174 @@ cirion::Entity::~Entity()
     {
         delete mSprites[i];
     }
+
+    if( mPrototype != NULL )
+    {
+        mPrototype->release();
+    }
 }
 
-//! @brief Procédure de chargement du fichier XML de l'entité.
+//! @brief Procédure de liaison de l'entité à son prototype, chargé et
+//!        compilé depuis son fichier XML au besoin.
 //! @name Nom de l'entité dans le répertoire des entités.
 //! @throw CiException en cas d'échec.
 void cirion::Entity::load( const char* entityName )
 {
-    ostringstream filepath;
+    CIRION_PROFILE_ZONE( "Entity::load" );
 
-    filepath << gWorkingDir
-             << "/Entities/"
-             << entityName
-             << ".xml";
+    EntityPrototype* prototype = cirion::getPrototype( entityName );
 
-    if( mXml.LoadFile( filepath.str().c_str() ) != XML_NO_ERROR )
+    if( mPrototype != NULL )
     {
-        ostringstream oss;
+        mPrototype->release();
+    }
 
-        oss << "Unable to load the entity xml file \""
-            << filepath.str()
-            << "\": "
-            << getXmlErrorStr( mXml.ErrorID() );
+    mPrototype = prototype;
+    mPrototype->acquire();
+}
 
-        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+//! @brief Fonction de vérification des données rechargées d'un prototype,
+//!        avant leur échange.
+//! @param cef Les nouvelles données.
+//! @return Le nom du premier sprite de l'entité absent de cef, ou NULL.
+const char* cirion::Entity::findMissingSprite( Cef& cef )
+{
+    for( size_t i = 0; i != mSprites.size(); i++ )
+    {
+        if( cef.getSprite( mSprites[i]->getName() ) == NULL )
+        {
+            return mSprites[i]->getName();
+        }
     }
+
+    return NULL;
 }
 
-//! @brief Procédure de dessin de l'entité.
-//! @param xOrigin Abscisse de l'origine du repère.
-//! @param yOrigin Ordonnée de l'origine du repère.
-void cirion::Entity::draw( const Point2f& origin )
+//! @brief Procédure de recréation des sprites après le rechargement du
+//!        prototype, en conservant l'animation en cours de chaque sprite.
+//!
+//! Appelée par EntityPrototype::reload() une fois les sprites et textures
+//! vérifiés, les anciennes données encore en vie: elle ne lève pas
+//! d'exception.
+void cirion::Entity::reload()
 {
-    Point2f absolute;
+    for( size_t i = 0; i != mSprites.size(); i++ )
+    {
+        SpriteData* data = mPrototype->getSprite( mSprites[i]->getName() );
+        // Copié: le nom appartient aux anciennes données.
+        string      animationName( mSprites[i]->getAnimationName() != NULL
+                                 ? mSprites[i]->getAnimationName()
+                                 : "" );
+        int         animationId = data->initialAnimation;
+
+        for( size_t j = 0; j != data->animations.size(); j++ )
+        {
+            if( animationName == data->animations[j].name )
+            {
+                animationId = (int)j;
+                break;
+            }
+        }
+
+        try
+        {
+            mSprites[i]->create( *data );
+            mSprites[i]->setAnimation( animationId );
+        }
+
+        catch( CiException const& e )
+        {
+            log( e );
+        }
+    }
+}
+
+//! @brief Procédure d'ajout d'un sprite à l'entité, qui en devient
+//!        propriétaire: le sprite est placé sur l'entité par
+//!        gRegistry.updateAttachments().
+//! @param sprite Pointeur vers le sprite.
+void cirion::Entity::addSprite( Sprite* sprite )
+{
+    sprite->setParent( mId );
+    sprite->setStateFlags( &mStateFlags );
+    mSprites.push_back( sprite );
+}
 
+//! @brief Procédure de dessin de l'entité seule.
+//! @param origin L'origine du repère d'affichage.
+void cirion::Entity::draw( const Point2f& origin )
+{
     for( size_t i = 0; i != mSprites.size(); i++ )
     {
-        mSprites[i]->update();
-        // Calcul de la position absolue du sprite
-        absolute = mPosition + mSprites[i]->getRelative();
-        mSprites[i]->setPosition( absolute );
-        // Dessin du sprite
         mSprites[i]->draw( origin );
     }
 }
 
-//! @brief  Fonction de récuperation d'un noeud <sprite> dans le XML de l'entité.
-//! @brief  spriteNodeName Nom du noeud du sprite.
-//! @return Pointeur vers le noeud <sprite>
-//! @throw  CiException en cas d'échec.
-XMLElement* cirion::Entity::getSpriteNode( const char* spriteName )
+//! @brief  Fonction accesseur.
+//! @return Le nom de l'entité dans le répertoire des entités.
+const char* cirion::Entity::getName()
 {
-    XMLElement* entityNode;
-    XMLElement* spriteNode;
-
-    // Récuperation du noeud <entity>.
-    entityNode = mXml.FirstChildElement( (const char*)"entity" );
+    return mPrototype != NULL ? mPrototype->getName() : "";
+}
 
-    if( entityNode == NULL )
-    {
-        ostringstream oss;
+//! @brief  Fonction accesseur.
+//! @return Le prototype partagé de l'entité.
+EntityPrototype* cirion::Entity::getPrototype()
+{
+    return mPrototype;
+}
 
-        oss << "Unable to get sprite node \""
-            << spriteName
-            << "\": Expected <entity> node.";
+//! @brief  Fonction de calcul de la mémoire propre à l'instance, hors données
+//!         partagées par le prototype.
+//! @return La taille en octets.
+size_t cirion::Entity::getInstanceSize()
+{
+    size_t size = sizeof(Entity) + mSprites.capacity() * sizeof(Sprite*);
 
-        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    for( size_t i = 0; i != mSprites.size(); i++ )
+    {
+        size += mSprites[i]->getInstanceSize();
     }
 
-    // Récuperation du premier noeud <sprite>.
-    spriteNode = entityNode->FirstChildElement( (const char*)"sprite" );
+    return size;
+}
 
-    if( spriteNode == NULL )
+//! @brief  Fonction de récuperation des données d'un sprite de l'entité.
+//! @brief  spriteName Nom du sprite.
+//! @return Pointeur vers les données du sprite.
+//! @throw  CiException en cas d'échec.
+SpriteData* cirion::Entity::getSpriteData( const char* spriteName )
+{
+    SpriteData* data = mPrototype != NULL
+                     ? mPrototype->getSprite( spriteName )
+                     : NULL;
+
+    if( data == NULL )
     {
         ostringstream oss;
 
-        oss << "Unable to get sprite node \""
+        oss << "Unable to get sprite data \""
             << spriteName
-            << "\": Expected <sprite> node.";
+            << "\": not found.";
 
         throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
     }
 
-    while( (string)( spriteNode->Attribute( "name" ) ) != spriteName )
-    {
-        spriteNode = spriteNode->NextSiblingElement();
-
-        if( spriteNode == NULL )
-        {
-            ostringstream oss;
-
-            oss << "Unable to get sprite node \""
-                << spriteName
-                << "\": not found.";
+    return data;
+}
 
-            throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
-        }
-    }
+//! @brief Procédure de modification d'un drapeau d'état.
+//! @param flag Le drapeau (StateFlag).
+//! @param value Vrai pour lever le drapeau, faux pour le baisser.
+void cirion::Entity::setStateFlag( Uint32 flag, bool value )
+{
+    mStateFlags = value ? ( mStateFlags | flag ) : ( mStateFlags & ~flag );
+}
 
-    return spriteNode;
+//! @brief  Fonction accesseur.
+//! @return Les drapeaux d'état de l'entité.
+Uint32 cirion::Entity::getStateFlags()
+{
+    return mStateFlags;
 }
+
@@ -0,0 +1,291 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    eventdispatcher.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Distribution des évenements aux objets abonnés.
+ */
+
+#include <algorithm>
+#include <Cirion/cirion.hpp>
+#include <Cirion/eventdispatcher.hpp>
+#include <Cirion/gameobject.hpp>
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe EventDispatcher.
+cirion::EventDispatcher::EventDispatcher():
+    mDepth  ( 0 ),
+    mIsDirty( false )
+{
+}
+
+//! @brief Déstructeur pour la classe EventDispatcher.
+cirion::EventDispatcher::~EventDispatcher()
+{
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure d'abonnement d'un objet à un type d'évenement.
+//!
+//! Un objet déjà abonné au type ne l'est pas deux fois.
+//! @param type   Le type d'évenement SDL (SDL_KEYDOWN, ...).
+//! @param object L'objet à prévenir.
+void cirion::EventDispatcher::subscribe( Uint32 type, GameObject* object )
+{
+    if( object == NULL )
+    {
+        return;
+    }
+
+    vector<GameObject*>& listeners = mListeners[type];
+
+    if( find( listeners.begin(), listeners.end(), object ) == listeners.end() )
+    {
+        listeners.push_back( object );
+    }
+}
+
+//! @brief Procédure de désabonnement d'un objet d'un type d'évenement.
+//! @param type   Le type d'évenement SDL.
+//! @param object L'objet à ne plus prévenir.
+void cirion::EventDispatcher::unsubscribe( Uint32 type, GameObject* object )
+{
+    ListenerMap::iterator it = mListeners.find( type );
+
+    if( it == mListeners.end() )
+    {
+        return;
+    }
+
+    vector<GameObject*>::iterator listener = find( it->second.begin(),
+                                                   it->second.end(),
+                                                   object );
+
+    if( listener == it->second.end() )
+    {
+        return;
+    }
+
+    /* Pendant une distribution, la place est seulement vidée: les indices
+    de la boucle en cours restent valides. */
+    if( mDepth != 0 )
+    {
+        *listener = NULL;
+        mIsDirty  = true;
+        return;
+    }
+
+    it->second.erase( listener );
+
+    if( it->second.empty() )
+    {
+        mListeners.erase( it );
+    }
+}
+
+//! @brief Procédure de désabonnement d'un objet de tous les types.
+//!
+//! Appelée à la destruction de chaque GameObject.
+//! @param object L'objet à ne plus prévenir.
+void cirion::EventDispatcher::unsubscribe( GameObject* object )
+{
+    ListenerMap::iterator it = mListeners.begin();
+
+    while( it != mListeners.end() )
+    {
+        // unsubscribe() peut effacer l'entrée courante.
+        Uint32 type = it->first;
+
+        ++it;
+        unsubscribe( type, object );
+    }
+}
+
+//! @brief Procédure d'abonnement d'un objet à une action du joueur.
+//! @param action L'action (ACTION_LEFT, ...).
+//! @param object L'objet à prévenir de ses fronts.
+void cirion::EventDispatcher::subscribeAction( Action action,
+                                               GameObject* object )
+{
+    subscribe( DISPATCHER_ACTION | action, object );
+}
+
+//! @brief Procédure de désabonnement d'un objet d'une action du joueur.
+//! @param action L'action.
+//! @param object L'objet à ne plus prévenir.
+void cirion::EventDispatcher::unsubscribeAction( Action action,
+                                                 GameObject* object )
+{
+    unsubscribe( DISPATCHER_ACTION | action, object );
+}
+
+//! @brief Procédure de distribution d'un évenement à ses abonnés.
+//! @param event Pointeur vers une structure d'évenements SDL2.
+void cirion::EventDispatcher::dispatch( SDL_Event* event )
+{
+    if( event == NULL )
+    {
+        return;
+    }
+
+    gStats.eventsDispatched++;
+    deliver( event->type, event, ACTION_COUNT, false );
+}
+
+//! @brief Procédure de distribution d'un front d'action à ses abonnés.
+//!
+//! Appelée par gInputSystem.sample(), juste avant le pas de simulation.
+//! @param action    L'action enfoncée ou relachée.
+//! @param isPressed Vrai si l'action vient d'être enfoncée.
+void cirion::EventDispatcher::dispatchAction( Action action, bool isPressed )
+{
+    gStats.eventsDispatched++;
+    deliver( DISPATCHER_ACTION | action, NULL, action, isPressed );
+}
+
+//! @brief Procédure de désabonnement de tous les objets.
+void cirion::EventDispatcher::clear()
+{
+    if( mDepth != 0 )
+    {
+        for( ListenerMap::iterator it = mListeners.begin();
+             it != mListeners.end();
+             ++it )
+        {
+            fill( it->second.begin(), it->second.end(), (GameObject*)NULL );
+        }
+
+        mIsDirty = true;
+        return;
+    }
+
+    mListeners.clear();
+    mIsDirty = false;
+}
+
+//! @brief Fonction accesseur.
+//! @param type Le type d'évenement SDL.
+//! @return Le nombre d'objets abonnés au type.
+size_t cirion::EventDispatcher::getListenerCount( Uint32 type )
+{
+    ListenerMap::iterator it = mListeners.find( type );
+
+    if( it == mListeners.end() )
+    {
+        return 0;
+    }
+
+    return it->second.size()
+         - count( it->second.begin(), it->second.end(), (GameObject*)NULL );
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées.                                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de remise aux abonnés d'une clé.
+//! @param key       Le type d'évenement, ou DISPATCHER_ACTION | action.
+//! @param event     L'évenement SDL, ou NULL pour une action.
+//! @param action    L'action, si event est NULL.
+//! @param isPressed Vrai si l'action vient d'être enfoncée.
+void cirion::EventDispatcher::deliver( Uint32 key, SDL_Event* event,
+                                       Action action, bool isPressed )
+{
+    ListenerMap::iterator it = mListeners.find( key );
+
+    if( it == mListeners.end() )
+    {
+        return;
+    }
+
+    /* Les abonnés ajoutés par un gestionnaire sont hors du compte: ils
+    attendent l'évenement suivant. */
+    vector<GameObject*>& listeners = it->second;
+    size_t               count     = listeners.size();
+
+    mDepth++;
+
+    for( size_t i = 0; i != count; i++ )
+    {
+        if( listeners[i] == NULL )
+        {
+            continue;
+        }
+
+        if( event != NULL )
+        {
+            listeners[i]->handleEvent( event );
+        }
+
+        else
+        {
+            listeners[i]->handleAction( action, isPressed );
+        }
+
+        gStats.eventDeliveries++;
+    }
+
+    mDepth--;
+
+    if( mDepth == 0 && mIsDirty )
+    {
+        compact();
+    }
+}
+
+//! @brief Procédure de retrait des places vidées pendant les distributions.
+void cirion::EventDispatcher::compact()
+{
+    ListenerMap::iterator it = mListeners.begin();
+
+    while( it != mListeners.end() )
+    {
+        vector<GameObject*>& listeners = it->second;
+
+        listeners.erase( remove( listeners.begin(), listeners.end(),
+                                 (GameObject*)NULL ),
+                         listeners.end() );
+
+        if( listeners.empty() )
+        {
+            mListeners.erase( it++ );
+        }
+
+        else
+        {
+            ++it;
+        }
+    }
+
+    mIsDirty = false;
+}
@@ -0,0 +1,238 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    framepacer.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Cadence des images.
+ */
+
+#include <Cirion/framepacer.hpp>
+#include <Cirion/profiler.hpp>
+#include <Cirion/timer.hpp>
+
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe FramePacer.
+cirion::FramePacer::FramePacer():
+    mRate        ( 0 ),
+    mIdleTimeout ( 100 ),
+    mPeriod      ( 0 ),
+    mDeadline    ( 0 ),
+    mOvershoot   ( 0 ),
+    mStartCounter( 0 ),
+    mSleepCounter( 0 ),
+    mSpinCounter ( 0 ),
+    mIdleCount   ( 0 )
+{
+}
+
+//! @brief Déstructeur pour la classe FramePacer.
+cirion::FramePacer::~FramePacer()
+{
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de choix de la cadence.
+//! @param rate Images par seconde visées, 0 pour ne pas attendre.
+void cirion::FramePacer::setTargetRate( int rate )
+{
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+
+    mRate      = rate > 0 ? rate : 0;
+    mPeriod    = mRate > 0 ? frequency / mRate : 0;
+    mDeadline  = 0;
+    mOvershoot = frequency * FRAMEPACER_OVERSHOOT / 1000;
+}
+
+//! @brief Procédure de choix de l'attente maximale d'évenements: la boucle
+//!        tourne au moins à ce rythme, même sans entrée.
+//! @param timeout L'attente, en ms.
+void cirion::FramePacer::setIdleTimeout( int timeout )
+{
+    mIdleTimeout = timeout > 0 ? timeout : 1;
+}
+
+//! @brief Fonction d'attente de la fin de l'image en cours.
+//!
+//! Une image en retard de moins d'une période raccourcit la suivante; au
+//! delà, la cadence repart de l'instant présent plutôt que d'enchaîner des
+//! images sans attente.
+//! @param idle Vrai si rien n'anime: l'attente porte alors sur la file
+//!        d'évenements, au plus mIdleTimeout ms.
+//! @return Vrai après une attente d'évenements: le temps écoulé n'est pas à
+//!         simuler.
+bool cirion::FramePacer::wait( bool idle )
+{
+    CIRION_PROFILE_ZONE( "FramePacer::wait" );
+
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    mStartCounter = mStartCounter == 0 ? now : mStartCounter;
+
+    // --- Attente d'évenements, sans les retirer de la file. ------------------
+    if( idle )
+    {
+        SDL_WaitEventTimeout( NULL, mIdleTimeout );
+
+        mDeadline      = SDL_GetPerformanceCounter();
+        mSleepCounter += mDeadline - now;
+        mIdleCount++;
+        return true;
+    }
+
+    if( mPeriod == 0 )
+    {
+        return false;
+    }
+
+    mDeadline += mPeriod;
+
+    if( now >= mDeadline )
+    {
+        mDeadline = now - mDeadline >= mPeriod ? now : mDeadline;
+        return false;
+    }
+
+    sleep();
+    spin();
+    return false;
+}
+
+//! @brief Fonction accesseur.
+//! @return Images par seconde visées, 0 si la boucle n'attend pas.
+int cirion::FramePacer::getTargetRate()
+{
+    return mRate;
+}
+
+//! @brief Fonction accesseur.
+//! @return Dépassement estimé d'un sommeil, en ns.
+Uint64 cirion::FramePacer::getOvershoot()
+{
+    return HrTimer::toNanoseconds( mOvershoot );
+}
+
+//! @brief Fonction accesseur.
+//! @return Temps dormi ou passé à attendre des évenements, en ns.
+Uint64 cirion::FramePacer::getSleepTime()
+{
+    return HrTimer::toNanoseconds( mSleepCounter );
+}
+
+//! @brief Fonction accesseur.
+//! @return Temps passé en attente active, en ns.
+Uint64 cirion::FramePacer::getSpinTime()
+{
+    return HrTimer::toNanoseconds( mSpinCounter );
+}
+
+//! @brief Fonction accesseur.
+//! @return Temps écoulé depuis la première attente, en ns.
+Uint64 cirion::FramePacer::getElapsedTime()
+{
+    return mStartCounter != 0
+         ? HrTimer::toNanoseconds( SDL_GetPerformanceCounter() - mStartCounter )
+         : 0;
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre d'attentes d'évenements.
+unsigned int cirion::FramePacer::getIdleCount()
+{
+    return mIdleCount;
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées.                                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de sommeil jusqu'à l'échéance, moins le dépassement
+//!        estimé.
+//!
+//! Chaque sommeil mesure son dépassement: l'estimation monte vite (un
+//! dépassement manqué coûte une image) et redescend lentement. Elle est
+//! bornée au quart de la période, pour qu'un pic isolé (préemption) ne
+//! change pas la boucle en attente active; sans sommeil, elle redescend
+//! aussi.
+void cirion::FramePacer::sleep()
+{
+    Uint64 millisecond = SDL_GetPerformanceFrequency() / 1000;
+    Uint64 now         = SDL_GetPerformanceCounter();
+    bool   slept       = false;
+
+    while( mDeadline > now && mDeadline - now > mOvershoot + millisecond )
+    {
+        Uint32 delay     = (Uint32)( ( mDeadline - now - mOvershoot ) / millisecond );
+        Uint64 requested = delay * millisecond;
+        Uint64 actual;
+        Uint64 overshoot;
+
+        SDL_Delay( delay );
+
+        actual         = SDL_GetPerformanceCounter() - now;
+        overshoot      = actual > requested ? actual - requested : 0;
+        mOvershoot     = overshoot > mOvershoot
+                       ? mOvershoot + ( overshoot - mOvershoot + 3 ) / 4
+                       : mOvershoot - ( mOvershoot - overshoot ) / 16;
+        mOvershoot     = mOvershoot > mPeriod / 4 ? mPeriod / 4 : mOvershoot;
+        mSleepCounter += actual;
+        now           += actual;
+        slept          = true;
+    }
+
+    if( !slept )
+    {
+        mOvershoot -= mOvershoot / 16;
+    }
+}
+
+//! @brief Procédure d'attente active jusqu'à l'échéance.
+void cirion::FramePacer::spin()
+{
+    Uint64 start = SDL_GetPerformanceCounter();
+    Uint64 now   = start;
+
+    while( now < mDeadline )
+    {
+        #ifdef __SSE2__
+        _mm_pause();
+        #endif // __SSE2__
+
+        now = SDL_GetPerformanceCounter();
+    }
+
+    mSpinCounter += now - start;
+}
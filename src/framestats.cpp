@@ -0,0 +1,399 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    framestats.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Statistiques des durées d'images.
+ */
+
+#include <iomanip>
+#include <sstream>
+#include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/framestats.hpp>
+#include <Cirion/log.hpp>
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs de Histogram.              !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe Histogram.
+cirion::Histogram::Histogram():
+    mBuckets( HISTOGRAM_BUCKETS, 0 ),
+    mCount  ( 0 )
+{
+}
+
+//! @brief Déstructeur pour la classe Histogram.
+cirion::Histogram::~Histogram()
+{
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques de Histogram.                       !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure d'ajout d'une durée.
+//! @param value La durée.
+void cirion::Histogram::add( Uint64 value )
+{
+    mBuckets[ getIndex( value ) ]++;
+    mCount++;
+}
+
+//! @brief Procédure de retrait d'une durée ajoutée auparavant.
+//! @param value La durée.
+void cirion::Histogram::remove( Uint64 value )
+{
+    mBuckets[ getIndex( value ) ]--;
+    mCount--;
+}
+
+//! @brief Procédure de remise à zéro.
+void cirion::Histogram::clear()
+{
+    mBuckets.assign( HISTOGRAM_BUCKETS, 0 );
+    mCount = 0;
+}
+
+//! @brief Fonction de calcul d'un centile.
+//! @param percentile Le centile, dans [0, 100].
+//! @return La plus grande valeur du seau du centile, 0 si vide.
+Uint64 cirion::Histogram::getPercentile( double percentile )
+{
+    Uint64 target = (Uint64)( percentile / 100.0 * (double)mCount + 0.5 );
+    Uint64 count  = 0;
+
+    target = target == 0 ? 1 : target;
+
+    for( size_t i = 0; i != mBuckets.size(); i++ )
+    {
+        count += mBuckets[i];
+
+        if( count >= target )
+        {
+            return getLowerBound( i + 1 ) - 1;
+        }
+    }
+
+    return 0;
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre de durées.
+Uint64 cirion::Histogram::getCount()
+{
+    return mCount;
+}
+
+//! @brief Fonction de comptage des durées d'un intervalle.
+//! @param from Début de l'intervalle, arrondi au seau.
+//! @param to Fin de l'intervalle (exclue), arrondie au seau.
+//! @return Le nombre de durées des seaux de l'intervalle.
+Uint64 cirion::Histogram::getCount( Uint64 from, Uint64 to )
+{
+    Uint64 count = 0;
+
+    for( size_t i = getIndex( from ); i < mBuckets.size() && getLowerBound( i ) < to; i++ )
+    {
+        count += mBuckets[i];
+    }
+
+    return count;
+}
+
+//! @brief Fonction de calcul du seau d'une valeur.
+//!
+//! Sous 2^SUB_BITS, un seau par valeur. Au delà, la puissance de 2 de la
+//! valeur choisit une série de 2^(SUB_BITS-1) seaux, ses bits suivants le
+//! seau de la série.
+//! @param value La valeur.
+//! @return L'indice du seau.
+size_t cirion::Histogram::getIndex( Uint64 value )
+{
+    const size_t sub  = 1 << HISTOGRAM_SUB_BITS;
+    const size_t half = sub / 2;
+    size_t       magnitude = HISTOGRAM_SUB_BITS;
+    size_t       shift;
+
+    if( value < sub )
+    {
+        return (size_t)value;
+    }
+
+    while( magnitude + 1 < 64 && ( value >> ( magnitude + 1 ) ) != 0 )
+    {
+        magnitude++;
+    }
+
+    if( magnitude >= HISTOGRAM_MAGNITUDES )
+    {
+        return HISTOGRAM_BUCKETS - 1;
+    }
+
+    shift = magnitude - ( HISTOGRAM_SUB_BITS - 1 );
+
+    return sub + ( shift - 1 ) * half + (size_t)( value >> shift ) - half;
+}
+
+//! @brief Fonction de calcul de la plus petite valeur d'un seau.
+//! @param index L'indice du seau.
+//! @return La plus petite valeur du seau.
+Uint64 cirion::Histogram::getLowerBound( size_t index )
+{
+    const size_t sub  = 1 << HISTOGRAM_SUB_BITS;
+    const size_t half = sub / 2;
+
+    if( index < sub )
+    {
+        return index;
+    }
+
+    return (Uint64)( half + ( index - sub ) % half )
+        << ( ( index - sub ) / half + 1 );
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs de FrameStats.             !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe FrameStats.
+//! @param window Le nombre de durées de la fenêtre glissante.
+cirion::FrameStats::FrameStats( size_t window ):
+    mWindow     ( window != 0 ? window : 1, 0 ),
+    mWindowNext ( 0 ),
+    mWindowCount( 0 ),
+    mTotalMin   ( 0 ),
+    mTotalMax   ( 0 ),
+    mTotalSum   ( 0 )
+{
+}
+
+//! @brief Déstructeur pour la classe FrameStats.
+cirion::FrameStats::~FrameStats()
+{
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques de FrameStats.                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure d'ajout d'une durée.
+//!
+//! La plus ancienne durée de la fenêtre en sort, et de son histogramme:
+//! l'ajout est en temps constant.
+//! @param duration La durée, en ns.
+void cirion::FrameStats::add( Uint64 duration )
+{
+    if( mWindowCount == mWindow.size() )
+    {
+        mWindowHistogram.remove( mWindow[mWindowNext] );
+    }
+
+    else
+    {
+        mWindowCount++;
+    }
+
+    mWindow[mWindowNext] = duration;
+    mWindowNext          = ( mWindowNext + 1 ) % mWindow.size();
+    mWindowHistogram.add( duration );
+
+    mTotalMin  = mTotalHistogram.getCount() == 0 || duration < mTotalMin
+               ? duration
+               : mTotalMin;
+    mTotalMax  = duration > mTotalMax ? duration : mTotalMax;
+    mTotalSum += duration;
+    mTotalHistogram.add( duration );
+}
+
+//! @brief Procédure de remise à zéro.
+void cirion::FrameStats::clear()
+{
+    mWindowNext  = 0;
+    mWindowCount = 0;
+    mTotalMin    = 0;
+    mTotalMax    = 0;
+    mTotalSum    = 0;
+    mWindowHistogram.clear();
+    mTotalHistogram.clear();
+}
+
+//! @brief Fonction accesseur.
+//! @param age L'âge de la durée dans la fenêtre, 0 pour la dernière.
+//! @return La durée, en ns, 0 au delà des durées de la fenêtre.
+Uint64 cirion::FrameStats::getRecent( size_t age )
+{
+    if( age >= mWindowCount )
+    {
+        return 0;
+    }
+
+    return mWindow[ ( mWindowNext + mWindow.size() - 1 - age ) % mWindow.size() ];
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre de durées de la fenêtre glissante.
+size_t cirion::FrameStats::getWindowCount()
+{
+    return mWindowCount;
+}
+
+//! @brief Fonction de résumé de la fenêtre glissante. Les extrêmes et la
+//!        moyenne sont exacts, les centiles à la précision des seaux.
+//! @return Le résumé, en ns.
+FrameSummary cirion::FrameStats::getWindowSummary()
+{
+    FrameSummary summary;
+    Uint64       sum = 0;
+
+    summary.count = mWindowCount;
+    summary.min   = 0;
+    summary.max   = 0;
+
+    for( size_t i = 0; i != mWindowCount; i++ )
+    {
+        summary.min = i == 0 || mWindow[i] < summary.min ? mWindow[i] : summary.min;
+        summary.max = mWindow[i] > summary.max ? mWindow[i] : summary.max;
+        sum        += mWindow[i];
+    }
+
+    summary.avg = mWindowCount != 0 ? sum / mWindowCount : 0;
+    summary.p50 = mWindowHistogram.getPercentile( 50.0 );
+    summary.p95 = mWindowHistogram.getPercentile( 95.0 );
+    summary.p99 = mWindowHistogram.getPercentile( 99.0 );
+    summary.p50 = summary.p50 > summary.max ? summary.max : summary.p50;
+    summary.p95 = summary.p95 > summary.max ? summary.max : summary.p95;
+    summary.p99 = summary.p99 > summary.max ? summary.max : summary.p99;
+
+    return summary;
+}
+
+//! @brief Fonction de résumé de la session. Les extrêmes et la moyenne sont
+//!        exacts, les centiles à la précision des seaux.
+//! @return Le résumé, en ns.
+FrameSummary cirion::FrameStats::getTotalSummary()
+{
+    FrameSummary summary;
+
+    summary.count = mTotalHistogram.getCount();
+    summary.min   = mTotalMin;
+    summary.max   = mTotalMax;
+    summary.avg   = summary.count != 0 ? mTotalSum / summary.count : 0;
+    summary.p50   = mTotalHistogram.getPercentile( 50.0 );
+    summary.p95   = mTotalHistogram.getPercentile( 95.0 );
+    summary.p99   = mTotalHistogram.getPercentile( 99.0 );
+    summary.p50   = summary.p50 > summary.max ? summary.max : summary.p50;
+    summary.p95   = summary.p95 > summary.max ? summary.max : summary.p95;
+    summary.p99   = summary.p99 > summary.max ? summary.max : summary.p99;
+
+    return summary;
+}
+
+//! @brief Fonction de mise en forme du résumé de la session, en ms.
+//! @param name Le nom de la série.
+//! @param histogram Indique l'ajout de l'histogramme, par puissance de 2.
+//! @return Le texte du rapport.
+string cirion::FrameStats::getReport( const char* name, bool histogram )
+{
+    ostringstream oss;
+    FrameSummary  summary = getTotalSummary();
+
+    oss << fixed
+        << setprecision( 3 )
+        << name
+        << "\t: "
+        << summary.count
+        << " sample(s), min "
+        << summary.min / 1000000.0
+        << ", avg "
+        << summary.avg / 1000000.0
+        << ", p50 "
+        << summary.p50 / 1000000.0
+        << ", p95 "
+        << summary.p95 / 1000000.0
+        << ", p99 "
+        << summary.p99 / 1000000.0
+        << ", max "
+        << summary.max / 1000000.0
+        << " ms";
+
+    for( size_t magnitude = 0;
+         histogram && summary.count != 0 && magnitude != HISTOGRAM_MAGNITUDES;
+         magnitude++ )
+    {
+        Uint64 from  = magnitude == 0 ? 0 : (Uint64)1 << magnitude;
+        Uint64 to    = (Uint64)1 << ( magnitude + 1 );
+        Uint64 count = mTotalHistogram.getCount( from, to );
+
+        if( count == 0 )
+        {
+            continue;
+        }
+
+        oss << endl
+            << "  ["
+            << setw( 9 )
+            << from / 1000000.0
+            << ", "
+            << setw( 9 )
+            << to / 1000000.0
+            << "[ ms: "
+            << setw( 7 )
+            << count
+            << " ("
+            << setprecision( 1 )
+            << setw( 5 )
+            << count * 100.0 / summary.count
+            << " %)"
+            << setprecision( 3 );
+    }
+
+    return oss.str();
+}
+
+//! @brief Procédure de report des durées d'images, de mises à jour et de
+//!        rendus au journal.
+void cirion::logFrameStats()
+{
+    ostringstream oss;
+
+    oss << gFrameStats.getReport( "Frame time", true )
+        << endl
+        << gUpdateStats.getReport( "Update time", false )
+        << endl
+        << gRenderStats.getReport( "Render time", false );
+
+    // Mesurée seulement sur demande (<input latency="true"/>).
+    if( gInputLatency.getTotalSummary().count != 0 )
+    {
+        oss << endl
+            << gInputLatency.getReport( "Input latency", true );
+    }
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
@@ -26,7 +26,6 @@
  * @brief   Manipulation des objets.
  */
 
-#include <cstring>
 #include <sstream>
 #include <vector>
 #include <Cirion/ciexception.hpp>
@@ -41,50 +40,73 @@ using namespace std;
 
 //! @brief Constructeur pour la classe GameObject.
 cirion::GameObject::GameObject():
-    mPosition( Point2f( 0, 0 ) ),
-    mTexture ( NULL )
+    mId( gRegistry.create() )
 {
-    mSrc.x  = 0;
-    mSrc.y  = 0;
-    mSrc.w  = 0;
-    mSrc.h  = 0;
-    mDest.x = 0;
-    mDest.y = 0;
-    mDest.w = 0;
-    mDest.h = 0;
+    Transform transform;
+
+    transform.position = Point2f( 0, 0 );
+    transform.previous = transform.position;
+    gRegistry.getTransforms().add( mId, transform );
 }
 
 //! @brief Déstructeur pour la classe GameObject.
 cirion::GameObject::~GameObject()
 {
+    gEventDispatcher.unsubscribe( this );
+    gRegistry.destroy( mId );
 }
 
-//! @brief Procédure de dessin de l'objet.
-//! @param xOrigin Abscisse de l'origine du repère.
-//! @param yOrigin Ordonnée de l'origine du repère.
-void cirion::GameObject::draw( const Point2f& origin )
+//! @brief Procédure de traîtement d'un front d'action.
+//!
+//! Reçue des actions auxquelles l'objet s'est abonné auprès de
+//! gEventDispatcher; ne fait rien par défaut.
+//! @param action    L'action enfoncée ou relachée.
+//! @param isPressed Vrai si l'action vient d'être enfoncée.
+void cirion::GameObject::handleAction( Action action, bool isPressed )
+{
+}
+
+//! @brief Fonction de test d'activité, consultée par isIdle().
+//!
+//! Un objet qui intègre lui-même son déplacement, sans composant Velocity,
+//! doit la redéfinir: sinon, l'attente d'évenements le figerait en l'air.
+//! @return Vrai si l'objet bouge encore; faux par défaut.
+bool cirion::GameObject::isActive()
 {
-    // Calcul des coordonnées d'affichage.
-    mDest.x = (int)( mPosition.mX - origin.mX );
-    mDest.y = (int)( mPosition.mY - origin.mY );
+    return false;
+}
 
-    if( mTexture != NULL )
+//! @brief Procédure de dessin de l'objet seul.
+//!
+//! Les objets sont dessinés en bloc par gRegistry.draw(); cette procédure
+//! reste pour dessiner un objet à part.
+//! @param origin L'origine du repère d'affichage.
+void cirion::GameObject::draw( const Point2f& origin )
+{
+    Renderable& renderable = getRenderable();
+    Point2f     position   = getPosition();
+    SDL_Rect    dest;
+
+    /* Calcul des coordonnées d'affichage: seul le rectangle rogné est copié,
+    décalé d'autant dans la cellule. */
+    dest.x = (int)( position.mX - origin.mX ) + renderable.offset.mX;
+    dest.y = (int)( position.mY - origin.mY ) + renderable.offset.mY;
+    dest.w = renderable.src.w;
+    dest.h = renderable.src.h;
+
+    if( renderable.texture != NULL )
     {
         // L'objet est-il visible ?
-        if(    mDest.x < gRendererWidth
-            && mDest.y < gRendererHeight )
+        if(    dest.x < gRendererWidth
+            && dest.y < gRendererHeight )
         {
-            if(    mDest.x + mDest.w > 0
-                && mDest.y + mDest.h > 0 )
+            if(    dest.x + dest.w > 0
+                && dest.y + dest.h > 0 )
             {
-                // Modulation alpha.
-                //mTexture->setAlphaMod( mAlpha );
-
                 // Copie de la texture dans le renderer.
-                SDL_RenderCopy( gRenderer,
-                                mTexture->getSdl2Texture(),
-                                &mSrc,
-                                &mDest );
+                renderCopy( renderable.texture->bind(),
+                            &renderable.src,
+                            &dest );
             }
         }
     }
@@ -95,46 +117,21 @@ void cirion::GameObject::draw( const Point2f& origin )
 //! @throw CiException en cas d'échec.
 void cirion::GameObject::setTexture( const char* name )
 {
-    // Drapeau d'existence de la texture demandée dans le vecteur des textures.
-    bool exists = false;
+    Renderable& renderable = getRenderable();
 
-    // Parcours du vecteur des textures.
-    for( size_t i = 0; i != gTextures.size(); i++ )
+    try
     {
-        // Si la texture demandée existe déjà dans le vecteur des textures :
-        if( strcmp( gTextures[i]->getName(), name) == 0 )
-        {
-            exists   = true;
-            mTexture = gTextures[i];
-            break;
-        }
+        renderable.texture = getTexture( name );
     }
 
-    // Si la texture n'existe pas dans le vecteur des textures :
-    if( !exists )
+    catch( CiException const& e )
     {
-        Texture* texture = new Texture();
-        
-        try
-        {
-            // Creation de la texture demandée.
-            texture->create( name );
-        }
-
-        catch( CiException const& e )
-        {
-            log( e );
-            mTexture = NULL;
-
-            throw CiException( 
-                (const char*)"Unable to set the requested texture.", 
-                __PRETTY_FUNCTION__ );
-        }
+        log( e );
+        renderable.texture = NULL;
 
-        /* On met la texture crée dans le vecteur des textures et on la lie à
-        l'objet. */
-        gTextures.push_back( texture );
-        mTexture = texture;
+        throw CiException( 
+            (const char*)"Unable to set the requested texture.", 
+            __PRETTY_FUNCTION__ );
     }
 }
 
@@ -145,39 +142,109 @@ void cirion::GameObject::setTexture( const char* name )
 //! @param h Hauteur du repère en pixels.
 void cirion::GameObject::setSrc( int x, int y, int w, int h )
 {
-    mSrc.x  = x;
-    mSrc.y  = y;
-    mSrc.w  = w;
-    mSrc.h  = h;
-    mDest.w = w;
-    mDest.h = h;
+    Renderable& renderable = getRenderable();
+
+    renderable.src.x = x;
+    renderable.src.y = y;
+    renderable.src.w = w;
+    renderable.src.h = h;
 }
 
 //! @brief Procédure de définition de la position de l'objet.
+//!
+//! Le rendu interpole depuis la position du début de la mise à jour: c'est
+//! un déplacement. Pour placer l'objet sans transition, voir warp().
 //! @param x Abcisse du repère en pixels.
 //! @param y Ordonnée du repère en pixels.
 void cirion::GameObject::setPosition( const Point2f& point )
 {
-    mPosition = point;
+    gRegistry.getTransforms().get( mId ).position = point;
+}
+
+//! @brief Procédure de placement immédiat de l'objet et de ses rattachés,
+//!        sans interpolation depuis l'ancienne position (création,
+//!        téléportation).
+//! @param position La nouvelle position, en pixels.
+void cirion::GameObject::warp( const Point2f& position )
+{
+    gRegistry.warp( mId, position );
+}
+
+//! @brief Procédure de définition de la vitesse de l'objet, appliquée par
+//!        gRegistry.updateMotion().
+//! @param velocity La vitesse, en pixels / ms.
+void cirion::GameObject::setVelocity( const Point2f& velocity )
+{
+    Velocity component;
+
+    component.velocity = velocity;
+    gRegistry.getVelocities().add( mId, component );
+}
+
+//! @brief Fonction accesseur.
+//! @return L'identifiant de l'objet dans gRegistry.
+ObjectId cirion::GameObject::getId()
+{
+    return mId;
 }
 
 //! @brief Fonction accesseur.
 //! @return Le repère source.
 SDL_Rect cirion::GameObject::getSrc()
 {
-    return mSrc;
+    return getRenderable().src;
 }
 
 //! @brief Fonction accesseur.
-//! @return Le repère de destination.
+//! @return Le repère de destination, à l'origine du monde.
 SDL_Rect cirion::GameObject::getDest()
 {
-    return mDest;
+    Renderable& renderable = getRenderable();
+    Point2f     position   = getPosition();
+    SDL_Rect    dest;
+
+    dest.x = (int)position.mX + renderable.offset.mX;
+    dest.y = (int)position.mY + renderable.offset.mY;
+    dest.w = renderable.src.w;
+    dest.h = renderable.src.h;
+
+    return dest;
 }
 
 // @brief Fonction accesseur.
 // @return La position de l'objet.
 Point2f cirion::GameObject::getPosition()
 {
-    return mPosition;
+    return gRegistry.getTransforms().get( mId ).position;
+}
+
+//! @brief Fonction accesseur.
+//! @return La vitesse de l'objet, nulle s'il n'en a pas.
+Point2f cirion::GameObject::getVelocity()
+{
+    return gRegistry.getVelocities().has( mId )
+         ? gRegistry.getVelocities().get( mId ).velocity
+         : Point2f( 0, 0 );
+}
+
+//! @brief Fonction accesseur; l'image est créée au premier accès.
+//! @return L'image de l'objet.
+Renderable& cirion::GameObject::getRenderable()
+{
+    if( !gRegistry.getRenderables().has( mId ) )
+    {
+        Renderable renderable;
+
+        renderable.texture = NULL;
+        renderable.src.x   = 0;
+        renderable.src.y   = 0;
+        renderable.src.w   = 0;
+        renderable.src.h   = 0;
+        renderable.offset  = Point2i( 0, 0 );
+        renderable.order   = gRegistry.getNextOrder();
+
+        return gRegistry.getRenderables().add( mId, renderable );
+    }
+
+    return gRegistry.getRenderables().get( mId );
 }
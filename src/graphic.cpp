@@ -54,7 +54,7 @@ void cirion::Graphic::handleEvent( SDL_Event* event )
 
 //! @brief Procédure de mise à jour de l'objet.
 //! @param timeStep Temps écoulé depuis la dernière image.
-void cirion::Graphic::update( int timeStep )
+void cirion::Graphic::update( float timeStep )
 {
     //!< Il n'y a pas de mises à jour à effectuer pour l'objet Graphic.
 }
@@ -34,6 +34,8 @@
 #include <Cirion/log.hpp>
 #include <Cirion/point2.hpp>
 #include <Cirion/sprite.hpp>
+#include <Cirion/statemachine.hpp>
+#include <Cirion/tilemap.hpp>
 
 using namespace cirion;
 using namespace std;
@@ -45,10 +47,9 @@ using namespace std;
 cirion::Hiro::Hiro():
     mXVelocity( 0 ),
     mYVelocity( 0 ),
-    mInputLeft( false ),
-    mInputRight( false ),
     mStatusGoLeft( false ),
-    mStatusGoRight( false )
+    mStatusGoRight( false ),
+    mIsGrounded( false )
 {
 }
 
@@ -68,11 +69,14 @@ void cirion::Hiro::create( const char* entityName )
         load( entityName );
         // Création, chargement et positionnement du sprite.
         mMainSprite = new Sprite();
-        mMainSprite->create( getSpriteNode( (const char*)"main" ) );
-        mMainSprite->setAnimation( (const char*)"standing" );
+        mMainSprite->create( *getSpriteData( (const char*)"main" ) );
         //mMainSprite->setRelative( Point2f( -8.0f, -8.0f ) );
-        // Envoi du sprite dans le vecteur des sprites de l'entité.
-        mSprites.push_back( mMainSprite );
+        // Rattachement du sprite à l'entité.
+        addSprite( mMainSprite );
+        // Abonnement aux actions du joueur.
+        gEventDispatcher.subscribeAction( ACTION_LEFT, this );
+        gEventDispatcher.subscribeAction( ACTION_RIGHT, this );
+        gEventDispatcher.subscribeAction( ACTION_JUMP, this );
     }
 
     catch( CiException const& e )
@@ -88,102 +92,70 @@ void cirion::Hiro::create( const char* entityName )
 //! @param event Pointeur vers une structure d'évenements SDL2.
 void cirion::Hiro::handleEvent( SDL_Event* event )
 {
-    if( event == NULL ) { return; }
+}
 
-    switch( event->type )
+//! @brief Procédure de traîtement d'un front d'action.
+//!
+//! Distribué par gInputSystem.sample(), juste avant le pas: la dernière
+//! direction enfoncée l'emporte.
+//! @param action    L'action enfoncée ou relachée.
+//! @param isPressed Vrai si l'action vient d'être enfoncée.
+void cirion::Hiro::handleAction( Action action, bool isPressed )
+{
+    switch( action )
     {
-        case SDL_KEYDOWN:
-        switch( event->key.keysym.sym )
+        case ACTION_LEFT:
+        mStatusGoLeft = isPressed;
+
+        if( isPressed )
+        {
+            mStatusGoRight = false;
+            mMainSprite->setFacingRight( false );
+        }
+
+        else if( gInputSystem.isDown( ACTION_RIGHT ) )
+        {
+            mStatusGoRight = true;
+            mMainSprite->setFacingRight( true );
+        }
+
+        break;
+
+        case ACTION_RIGHT:
+        mStatusGoRight = isPressed;
+
+        if( isPressed )
         {
-            // --- Touche de direction gauche enfoncée -------------------------
-            case SDLK_q:
-            if( !mInputLeft )
-            {
-                // Màj des entrées
-                mInputLeft = true;
-                // Màj du status
-                mStatusGoLeft   = true;
-                mStatusGoRight = false;
-                // Màj de l'orientation du sprite
-                mMainSprite->setAnimation( (const char*)"running" );
-                mMainSprite->setFacingRight( false );
-            }
-
-            break;
-
-            // --- Touche de direction droite enfoncée -------------------------
-            case SDLK_d:
-            if( !mInputRight )
-            {
-                // Màj des entrées
-                mInputRight = true;
-                // Màj du status
-                mStatusGoRight = true;
-                mStatusGoLeft  = false;
-                // Màj du sprite
-                mMainSprite->setAnimation( (const char*)"running" );
-                mMainSprite->setFacingRight( true );
-            }
-
-            break;
+            mStatusGoLeft = false;
+            mMainSprite->setFacingRight( true );
+        }
+
+        else if( gInputSystem.isDown( ACTION_LEFT ) )
+        {
+            mStatusGoLeft = true;
+            mMainSprite->setFacingRight( false );
         }
 
         break;
 
-        case SDL_KEYUP:
-        switch( event->key.keysym.sym )
+        case ACTION_JUMP:
+        // Saut, depuis le sol seulement
+        if( isPressed && mIsGrounded )
         {
-            // --- Touche de direction gauche relachée -------------------------
-            case SDLK_q:
-            if( mInputLeft )
-            { 
-                mInputLeft    = false;
-                mStatusGoLeft = false;
-   
-                if( mInputRight )
-                {
-                    mStatusGoRight = true;
-                    mMainSprite->setFacingRight( true );
-                }
-   
-                else
-                {
-                    mMainSprite->setAnimation( (const char*)"standing" );
-                }
-            }
-
-            break;
-
-            // --- Touche de direction droite relachée -------------------------
-            case SDLK_d:
-
-            if( mInputRight )
-            {
-                mInputRight    = false;
-                mStatusGoRight = false;
-
-                if( mInputLeft )
-                {
-                    mStatusGoLeft = true;
-                    mMainSprite->setFacingRight( false );
-                }
-
-                else
-                {
-                    mMainSprite->setAnimation( (const char*)"standing" );
-                }
-            }
-
-            break;
+            mYVelocity  = -HIRO_JUMP_VELOCITY;
+            mIsGrounded = false;
         }
-    
+
+        break;
+
+        default:
         break;
     }
 }
 
 //! @brief Procédure de mise à jour du personnage jouable.
 //! @param timeStep
-void cirion::Hiro::update( int timeStep )
+void cirion::Hiro::update( float timeStep )
 {
     if( mStatusGoLeft )
     {
@@ -229,8 +201,62 @@ void cirion::Hiro::update( int timeStep )
         }
     }
 
-    mPosition.mX += mXVelocity * timeStep;
+    // --- Gravité. ------------------------------------------------------------
+    mYVelocity += HIRO_GRAVITY * timeStep;
+    mYVelocity  = mYVelocity > HIRO_YVELOCITY_MAX
+                ? HIRO_YVELOCITY_MAX
+                : mYVelocity;
 
-    // Mise à jour du sprite
-    mMainSprite->update( timeStep );
+    // --- Déplacement contre la grille de tuiles. -----------------------------
+    SDL_Rect hitbox   = mMainSprite->getHitbox();
+    Point2f  position = getPosition();
+    Uint32   contacts;
+
+    hitbox.x += (int)mMainSprite->getRelative().mX;
+    hitbox.y += (int)mMainSprite->getRelative().mY;
+
+    contacts = gWorld.getTileMap().move( position,
+                                         hitbox,
+                                         Point2f( mXVelocity * timeStep,
+                                                  mYVelocity * timeStep ),
+                                         mIsGrounded );
+
+    setPosition( position );
+
+    if( contacts & TILE_CONTACT_WALL )
+    {
+        mXVelocity = 0;
+    }
+
+    if( contacts & ( TILE_CONTACT_GROUND | TILE_CONTACT_CEILING ) )
+    {
+        mYVelocity = 0;
+    }
+
+    mIsGrounded = ( contacts & TILE_CONTACT_GROUND ) != 0;
+
+    /* Les animations ne sont plus choisies ici: la machine à états du sprite
+    les déduit de ces drapeaux (voir updateStateMachines()). */
+    setStateFlag( STATE_MOVING,   mStatusGoLeft || mStatusGoRight );
+    setStateFlag( STATE_VELOCITY, mXVelocity != 0 );
+    setStateFlag( STATE_AIRBORNE, !mIsGrounded );
+}
+
+//! @brief Fonction de test d'activité: en l'air, en mouvement ou poussé
+//!        par une direction enfoncée.
+//! @return Vrai si le personnage bouge encore.
+bool cirion::Hiro::isActive()
+{
+    return    !mIsGrounded
+           || mXVelocity != 0
+           || mYVelocity != 0
+           || mStatusGoLeft
+           || mStatusGoRight;
+}
+
+//! @brief Fonction de calcul de la mémoire propre à l'instance.
+//! @return La taille en octets.
+size_t cirion::Hiro::getInstanceSize()
+{
+    return Entity::getInstanceSize() + sizeof(Hiro) - sizeof(Entity);
 }
@@ -0,0 +1,270 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    inputsystem.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Échantillonnage des entrées en actions.
+ */
+
+#include <Cirion/cirion.hpp>
+#include <Cirion/inputsystem.hpp>
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe InputSystem.
+cirion::InputSystem::InputSystem():
+    mIsLatencyMeasured( false )
+{
+    for( int i = 0; i != ACTION_COUNT; i++ )
+    {
+        mKeys[i] = SDLK_UNKNOWN;
+    }
+
+    clear();
+}
+
+//! @brief Déstructeur pour la classe InputSystem.
+cirion::InputSystem::~InputSystem()
+{
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure d'affectation des touches aux actions.
+//! @param keymap La carte des touches (codes SDLK_*).
+void cirion::InputSystem::setKeymap( const Keymap& keymap )
+{
+    mKeys[ACTION_UP]    = keymap.up;
+    mKeys[ACTION_DOWN]  = keymap.down;
+    mKeys[ACTION_LEFT]  = keymap.left;
+    mKeys[ACTION_RIGHT] = keymap.right;
+    mKeys[ACTION_JUMP]  = keymap.jump;
+    mKeys[ACTION_FIRE]  = keymap.fire;
+}
+
+//! @brief Procédure d'activation de la mesure de latence.
+//!
+//! Chaque appui échantillonné est daté de son évenement; la première
+//! présentation qui suit ajoute le délai à gInputLatency.
+//! @param isMeasured Vrai pour mesurer.
+void cirion::InputSystem::setLatencyMeasured( bool isMeasured )
+{
+    mIsLatencyMeasured = isMeasured;
+    mIsPending         = false;
+}
+
+//! @brief Procédure de traîtement d'un évenement clavier.
+//! @param event Pointeur vers une structure d'évenements SDL2.
+void cirion::InputSystem::handleEvent( SDL_Event* event )
+{
+    int    action;
+    Uint32 bit;
+
+    if(    event == NULL
+        || ( event->type != SDL_KEYDOWN && event->type != SDL_KEYUP ) )
+    {
+        return;
+    }
+
+    // La répétition automatique n'est pas un nouvel appui.
+    if( event->key.repeat != 0 )
+    {
+        return;
+    }
+
+    action = getAction( event->key.keysym.sym );
+
+    if( action < 0 )
+    {
+        return;
+    }
+
+    bit = 1 << action;
+
+    if( event->type == SDL_KEYDOWN )
+    {
+        if( ( mLive & bit ) == 0 )
+        {
+            mLive            |= bit;
+            mLatched         |= bit;
+            mLiveTime[action] = event->key.timestamp;
+        }
+    }
+
+    else
+    {
+        mLive &= ~bit;
+    }
+}
+
+//! @brief Procédure d'échantillonnage, juste avant un pas de simulation.
+void cirion::InputSystem::sample()
+{
+    Uint32 pressed;
+    Uint32 released;
+
+    // Enregistré, ou remplacé par la relecture en cours.
+    mPrevious = mState;
+    mState    = gReplay.next( mLive | mLatched );
+    mLatched  = 0;
+    pressed   = mState & ~mPrevious;
+    released  = ~mState & mPrevious;
+
+    for( int i = 0; pressed != 0 && i != ACTION_COUNT; i++ )
+    {
+        if( ( pressed & ( 1 << i ) ) == 0 )
+        {
+            continue;
+        }
+
+        mPressTime[i] = gReplay.isPlaying() ? SDL_GetTicks() : mLiveTime[i];
+
+        if(    mIsLatencyMeasured
+            && ( !mIsPending || (Sint32)( mPressTime[i] - mPendingTime ) < 0 ) )
+        {
+            mPendingTime = mPressTime[i];
+            mIsPending   = true;
+        }
+    }
+
+    // Fronts aux abonnés: les appuis d'abord, puis les relâchements.
+    for( int i = 0; pressed != 0 && i != ACTION_COUNT; i++ )
+    {
+        if( ( pressed & ( 1 << i ) ) != 0 )
+        {
+            gEventDispatcher.dispatchAction( (Action)i, true );
+        }
+    }
+
+    for( int i = 0; released != 0 && i != ACTION_COUNT; i++ )
+    {
+        if( ( released & ( 1 << i ) ) != 0 )
+        {
+            gEventDispatcher.dispatchAction( (Action)i, false );
+        }
+    }
+}
+
+//! @brief Procédure de fin de présentation d'une image.
+//!
+//! L'image présentée est la première à refléter les appuis en attente:
+//! leur latence, de l'évenement à l'écran, est comptée.
+void cirion::InputSystem::present()
+{
+    if( !mIsPending )
+    {
+        return;
+    }
+
+    gInputLatency.add( (Uint64)( SDL_GetTicks() - mPendingTime ) * 1000000 );
+    mIsPending = false;
+}
+
+//! @brief Procédure de remise à zéro des actions.
+void cirion::InputSystem::clear()
+{
+    mLive        = 0;
+    mLatched     = 0;
+    mState       = 0;
+    mPrevious    = 0;
+    mPendingTime = 0;
+    mIsPending   = false;
+
+    for( int i = 0; i != ACTION_COUNT; i++ )
+    {
+        mLiveTime[i]  = 0;
+        mPressTime[i] = 0;
+    }
+}
+
+//! @brief Fonction accesseur.
+//! @param action L'action.
+//! @return Vrai si l'action est tenue au dernier échantillon.
+bool cirion::InputSystem::isDown( Action action )
+{
+    return ( mState & ( 1 << action ) ) != 0;
+}
+
+//! @brief Fonction accesseur.
+//! @param action L'action.
+//! @return Vrai si l'action a été enfoncée depuis l'échantillon précédent.
+bool cirion::InputSystem::isPressed( Action action )
+{
+    return ( mState & ~mPrevious & ( 1 << action ) ) != 0;
+}
+
+//! @brief Fonction accesseur.
+//! @param action L'action.
+//! @return Vrai si l'action a été relachée depuis l'échantillon précédent.
+bool cirion::InputSystem::isReleased( Action action )
+{
+    return ( ~mState & mPrevious & ( 1 << action ) ) != 0;
+}
+
+//! @brief Fonction accesseur.
+//! @return Les actions tenues au dernier échantillon, un bit par action.
+Uint32 cirion::InputSystem::getState()
+{
+    return mState;
+}
+
+//! @brief Fonction accesseur.
+//! @param action L'action.
+//! @return L'instant du dernier appui échantillonné, en ms SDL.
+Uint32 cirion::InputSystem::getPressTime( Action action )
+{
+    return mPressTime[action];
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées.                                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Fonction de recherche de l'action d'une touche.
+//! @param key Le code de la touche.
+//! @return L'action, -1 si la touche n'est pas affectée.
+int cirion::InputSystem::getAction( SDL_Keycode key )
+{
+    if( key == SDLK_UNKNOWN )
+    {
+        return -1;
+    }
+
+    for( int i = 0; i != ACTION_COUNT; i++ )
+    {
+        if( mKeys[i] == key )
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
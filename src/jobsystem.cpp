@@ -0,0 +1,353 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    jobsystem.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Répartition des mises à jour sur les coeurs.
+ */
+
+#include <sstream>
+#include <Cirion/ciexception.hpp>
+#include <Cirion/jobsystem.hpp>
+#include <Cirion/log.hpp>
+#include <Cirion/profiler.hpp>
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe JobSystem.
+cirion::JobSystem::JobSystem():
+    mWake( NULL )
+{
+    SDL_AtomicSet( &mPending, 0 );
+    SDL_AtomicSet( &mIsRunning, 0 );
+}
+
+//! @brief Déstructeur pour la classe JobSystem.
+cirion::JobSystem::~JobSystem()
+{
+    stop();
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de démarrage des fils de travail.
+//!
+//! Faute de pouvoir créer un fil, le système continue avec ceux déjà créés
+//! (au pire, le seul fil principal).
+//! @param threadCount Le nombre de fils, principal compris; 0: un par coeur.
+void cirion::JobSystem::start( int threadCount )
+{
+    ostringstream oss;
+
+    stop();
+
+    if( threadCount <= 0 )
+    {
+        threadCount = SDL_GetCPUCount();
+    }
+
+    threadCount = threadCount < 1 ? 1 : threadCount;
+    threadCount = threadCount > JOBSYSTEM_MAX_THREADS
+                ? JOBSYSTEM_MAX_THREADS
+                : threadCount;
+
+    mWake = SDL_CreateSemaphore( 0 );
+    SDL_AtomicSet( &mPending, 0 );
+    SDL_AtomicSet( &mIsRunning, 1 );
+
+    // La file 0 est celle du fil principal.
+    for( int i = 0; i != threadCount; i++ )
+    {
+        JobQueue* queue = new JobQueue;
+
+        queue->top    = 0;
+        queue->bottom = 0;
+        queue->lock   = 0;
+        mQueues.push_back( queue );
+    }
+
+    for( int i = 1; i != threadCount && mWake != NULL; i++ )
+    {
+        JobWorker* worker = new JobWorker;
+
+        worker->system = this;
+        worker->index  = i;
+        worker->thread = SDL_CreateThread( work, "CirionWorker", worker );
+
+        if( worker->thread == NULL )
+        {
+            oss << "Unable to create a worker thread: "
+                << SDL_GetError();
+
+            log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+            oss.str( "" );
+            delete worker;
+            break;
+        }
+
+        mWorkers.push_back( worker );
+    }
+
+    // Les files sans fil ne reçoivent pas de tâches.
+    while( mQueues.size() > mWorkers.size() + 1 )
+    {
+        delete mQueues.back();
+        mQueues.pop_back();
+    }
+
+    oss << "Job system started with "
+        << mQueues.size()
+        << " thread(s).";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
+
+//! @brief Procédure d'arrêt des fils de travail.
+void cirion::JobSystem::stop()
+{
+    SDL_AtomicSet( &mIsRunning, 0 );
+
+    for( size_t i = 0; i != mWorkers.size(); i++ )
+    {
+        SDL_SemPost( mWake );
+    }
+
+    for( size_t i = 0; i != mWorkers.size(); i++ )
+    {
+        SDL_WaitThread( mWorkers[i]->thread, NULL );
+        delete mWorkers[i];
+    }
+
+    for( size_t i = 0; i != mQueues.size(); i++ )
+    {
+        delete mQueues[i];
+    }
+
+    mWorkers.clear();
+    mQueues.clear();
+
+    if( mWake != NULL )
+    {
+        SDL_DestroySemaphore( mWake );
+        mWake = NULL;
+    }
+}
+
+//! @brief Procédure de traîtement parallèle de [0, count[ par intervalles.
+//!
+//! Le fil principal participe puis attend la fin de toutes les tâches. Sans
+//! fil de travail, ou s'il n'y a qu'un intervalle, le traîtement est fait
+//! directement. Les tâches ne doivent pas lever d'exception.
+//! @param count Le nombre d'éléments.
+//! @param grain Le nombre minimum d'éléments par tâche.
+//! @param function La fonction de traîtement d'un intervalle.
+//! @param data Le paramètre de la fonction.
+void cirion::JobSystem::parallelFor( size_t count, size_t grain,
+                                     JobFunction function, void* data )
+{
+    size_t threads = mQueues.size();
+    size_t chunks;
+
+    grain  = grain == 0 ? 1 : grain;
+    chunks = ( count + grain - 1 ) / grain;
+
+    if( threads <= 1 || chunks <= 1 )
+    {
+        if( count != 0 )
+        {
+            function( data, 0, count );
+        }
+
+        return;
+    }
+
+    // Les files ne débordent pas: le grain grossit au besoin.
+    if( chunks > threads * JOBQUEUE_CAPACITY )
+    {
+        chunks = threads * JOBQUEUE_CAPACITY;
+        grain  = ( count + chunks - 1 ) / chunks;
+        chunks = ( count + grain - 1 ) / grain;
+    }
+
+    SDL_AtomicSet( &mPending, (int)chunks );
+
+    // Des blocs contigus par fil, pour la localité des données.
+    for( size_t i = 0; i != chunks; i++ )
+    {
+        Job job;
+
+        job.function = function;
+        job.data     = data;
+        job.first    = i * grain;
+        job.last     = job.first + grain < count ? job.first + grain : count;
+        push( (int)( i * threads / chunks ), job );
+    }
+
+    for( size_t i = 0; i != mWorkers.size(); i++ )
+    {
+        SDL_SemPost( mWake );
+    }
+
+    runPending( 0 );
+
+    // Attente des tâches en cours sur les autres fils.
+    {
+        CIRION_PROFILE_ZONE( "JobSystem::wait" );
+
+        while( SDL_AtomicGet( &mPending ) != 0 )
+        {
+        }
+    }
+
+    // Les écritures des autres fils sont visibles au retour.
+    SDL_MemoryBarrierAcquire();
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre de fils, principal compris.
+int cirion::JobSystem::getThreadCount()
+{
+    return mQueues.empty() ? 1 : (int)mQueues.size();
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées.                                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Fonction d'exécution d'un fil de travail.
+//! @param data Pointeur vers la structure JobWorker du fil.
+//! @return 0.
+int cirion::JobSystem::work( void* data )
+{
+    JobWorker* worker = (JobWorker*)data;
+    JobSystem* system = worker->system;
+
+    while( true )
+    {
+        SDL_SemWait( system->mWake );
+
+        if( SDL_AtomicGet( &system->mIsRunning ) == 0 )
+        {
+            break;
+        }
+
+        system->runPending( worker->index );
+    }
+
+    return 0;
+}
+
+//! @brief Procédure d'ajout d'une tâche en fin de file.
+//! @param index L'indice de la file.
+//! @param job La tâche.
+void cirion::JobSystem::push( int index, const Job& job )
+{
+    JobQueue* queue = mQueues[index];
+
+    SDL_AtomicLock( &queue->lock );
+    queue->jobs[ queue->bottom % JOBQUEUE_CAPACITY ] = job;
+    queue->bottom++;
+    SDL_AtomicUnlock( &queue->lock );
+}
+
+//! @brief Fonction de retrait d'une tâche en fin de sa propre file.
+//! @param index L'indice de la file.
+//! @param job La tâche retirée.
+//! @return Vrai si une tâche a été retirée.
+bool cirion::JobSystem::pop( int index, Job& job )
+{
+    JobQueue* queue = mQueues[index];
+    bool      found = false;
+
+    SDL_AtomicLock( &queue->lock );
+
+    if( queue->bottom != queue->top )
+    {
+        queue->bottom--;
+        job   = queue->jobs[ queue->bottom % JOBQUEUE_CAPACITY ];
+        found = true;
+    }
+
+    SDL_AtomicUnlock( &queue->lock );
+
+    return found;
+}
+
+//! @brief Fonction de vol d'une tâche en tête de la file d'un autre fil.
+//! @param index L'indice de la file du voleur.
+//! @param job La tâche volée.
+//! @return Vrai si une tâche a été volée.
+bool cirion::JobSystem::steal( int index, Job& job )
+{
+    size_t threads = mQueues.size();
+
+    for( size_t i = 1; i != threads; i++ )
+    {
+        JobQueue* queue = mQueues[ ( index + i ) % threads ];
+        bool      found = false;
+
+        SDL_AtomicLock( &queue->lock );
+
+        if( queue->bottom != queue->top )
+        {
+            job   = queue->jobs[ queue->top % JOBQUEUE_CAPACITY ];
+            queue->top++;
+            found = true;
+        }
+
+        SDL_AtomicUnlock( &queue->lock );
+
+        if( found )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//! @brief Procédure d'exécution des tâches, tant qu'il en reste à prendre.
+//! @param index L'indice de la file du fil.
+void cirion::JobSystem::runPending( int index )
+{
+    Job job;
+
+    while( pop( index, job ) || steal( index, job ) )
+    {
+        {
+            CIRION_PROFILE_ZONE( "Job" );
+            job.function( job.data, job.first, job.last );
+        }
+
+        // L'opération atomique publie aussi les écritures de la tâche.
+        SDL_AtomicAdd( &mPending, -1 );
+    }
+}
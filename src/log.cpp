@@ -31,42 +31,83 @@
 #include <fstream>
 #include <Cirion/ciexception.hpp>
 #include <Cirion/log.hpp>
+#include <Cirion/logger.hpp>
+
+#define LOG_FILE "Cirion.log" // Le fichier du journal, hors DEBUG
 
 using namespace std;
+using namespace cirion;
 
 #ifdef DEBUG
     /** Le flux de notre journal, redirigé vers std::clog */
     ostream gCirionLog( clog.rdbuf() );
 #else
     /** Un flux de fichier. */
-    ofstream gLogFile( "Cirion.log" );
+    ofstream gLogFile( LOG_FILE );
     /** Le flux de notre journal, redirigé vers le flux de fichier. */
     ostream  gCirionLog( gLogFile.rdbuf() );
 #endif
 
+/** Le fil d'écriture du journal. */
+Logger gLogger( gCirionLog );
+
+/** Les écritures directes, fil d'écriture arrêté, une à la fois. */
+static SDL_SpinLock gDirectLock = 0;
+
+//! @brief Procédure de démarrage de l'écriture différée du journal.
+void cirion::startLogging()
+{
+    #ifdef DEBUG
+        gLogger.start();
+    #else
+        gLogger.start( LOG_FILE );
+    #endif
+}
+
+//! @brief Procédure d'arrêt de l'écriture différée du journal.
+//!
+//! Les messages en attente sont écrits; les suivants le sont directement.
+void cirion::stopLogging()
+{
+    gLogger.stop();
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre de messages abandonnés, file d'attente pleine ou arrêt
+//! en cours.
+unsigned int cirion::getDroppedLogCount()
+{
+    return gLogger.getDroppedCount();
+}
+
 //! @brief Procédure de report des messages au journal.
+//!
+//! Le message est confié au fil d'écriture s'il tourne, sinon écrit
+//! directement.
 //! @param msg Message.
 //! @param from Identifiant de l'appelant.
 void cirion::log( const char* msg, const char* from )
 {
-    gCirionLog << "[INFO from "
-               << from
-               << "]: "
-               << endl
-               << msg
-               << endl
-               << endl;
+    const char* parts[] = { "[INFO from ", from, "]: \n", msg, "\n\n" };
+
+    if( !gLogger.push( parts, 5 ) )
+    {
+        SDL_AtomicLock( &gDirectLock );
+        gCirionLog << parts[0] << from << parts[2] << msg << parts[4] << flush;
+        SDL_AtomicUnlock( &gDirectLock );
+    }
 }
 
 //! @brief Procédure de report des exceptions au journal.
 //! @param e Exception Cirion
 void cirion::log( const CiException& e )
 {
-    gCirionLog << "[EXCEPTION from "
-               << e.from()
-               << "]: "
-               << endl
-               << e.what()
-               << endl
-               << endl;
+    const char* parts[] = { "[EXCEPTION from ", e.from(), "]: \n", e.what(), "\n\n" };
+
+    if( !gLogger.push( parts, 5 ) )
+    {
+        SDL_AtomicLock( &gDirectLock );
+        gCirionLog << parts[0] << e.from() << parts[2] << e.what() << parts[4] << flush;
+        SDL_AtomicUnlock( &gDirectLock );
+    }
 }
@@ -0,0 +1,537 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    logger.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Écriture différée du journal.
+ */
+
+#include <csignal>
+#include <cstring>
+#include <Cirion/logger.hpp>
+
+#ifdef _WIN32
+    #include <fcntl.h>  // _O_WRONLY, _O_APPEND
+    #include <io.h>     // _open(), _write(), _close()
+#else
+    #include <fcntl.h>  // open()
+    #include <unistd.h> // write(), close()
+#endif
+
+#define LOGGER_MASK      ( LOGGER_SLOTS - 1 )
+#define LOGGER_RING_SIZE ( LOGGER_SLOTS * LOGGER_SLOT_SIZE )
+
+using namespace std;
+using namespace cirion;
+
+//! Le journal à vider sur signal fatal.
+static Logger* gCrashLogger = NULL;
+
+//! Les signaux fatals interceptés.
+static const int gCrashSignals[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+
+//! @brief Fonction d'ouverture du journal, pour l'écriture sur signal fatal.
+//! @param path Le fichier du journal, ou NULL pour la sortie d'erreur.
+//! @return Le descripteur, ou -1 en cas d'échec.
+static int openCrashFile( const char* path )
+{
+    if( path == NULL )
+    {
+        return 2;
+    }
+
+    #ifdef _WIN32
+        return _open( path, _O_WRONLY | _O_APPEND | _O_BINARY );
+    #else
+        return open( path, O_WRONLY | O_APPEND );
+    #endif
+}
+
+//! @brief Procédure de fermeture du descripteur d'écriture sur signal fatal.
+//! @param fd Le descripteur; la sortie d'erreur reste ouverte.
+static void closeCrashFile( int fd )
+{
+    if( fd <= 2 )
+    {
+        return;
+    }
+
+    #ifdef _WIN32
+        _close( fd );
+    #else
+        close( fd );
+    #endif
+}
+
+//! @brief Procédure d'écriture sur signal fatal, sans flux ni allocation.
+//! @param fd Le descripteur.
+//! @param data Les octets à écrire.
+//! @param size Le nombre d'octets.
+static void writeCrashFile( int fd, const char* data, size_t size )
+{
+    while( size != 0 )
+    {
+        #ifdef _WIN32
+            int written = _write( fd, data, (unsigned int)size );
+        #else
+            ssize_t written = write( fd, data, size );
+        #endif
+
+        if( written <= 0 )
+        {
+            return;
+        }
+
+        data += written;
+        size -= written;
+    }
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe Logger.
+//! @param stream Le flux du journal.
+cirion::Logger::Logger( ostream& stream ):
+    mStream       ( stream ),
+    mRing         ( new char[LOGGER_RING_SIZE] ),
+    mTail         ( 0 ),
+    mReportedDrops( 0 ),
+    mCrashFd      ( -1 ),
+    mDrainLock    ( 0 ),
+    mWake         ( NULL ),
+    mThread       ( NULL )
+{
+    for( int i = 0; i != LOGGER_SLOTS; i++ )
+    {
+        SDL_AtomicSet( &mSequences[i], i );
+    }
+
+    SDL_AtomicSet( &mHead, 0 );
+    SDL_AtomicSet( &mDropped, 0 );
+    SDL_AtomicSet( &mIsRunning, 0 );
+    SDL_AtomicSet( &mIsSleeping, 0 );
+    SDL_AtomicSet( &mIsStopping, 0 );
+    SDL_AtomicSet( &mPushers, 0 );
+}
+
+//! @brief Déstructeur pour la classe Logger.
+cirion::Logger::~Logger()
+{
+    stop();
+    delete[] mRing;
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de démarrage du fil d'écriture.
+//!
+//! Sans fil, push() refuse les messages: l'appelant les écrit lui-même.
+//! @param crashPath Le fichier du journal, rouvert ici pour l'écriture sur
+//! signal fatal; NULL pour la sortie d'erreur.
+void cirion::Logger::start( const char* crashPath )
+{
+    if( SDL_AtomicGet( &mIsRunning ) != 0 )
+    {
+        return;
+    }
+
+    mWake = SDL_CreateSemaphore( 0 );
+
+    if( mWake == NULL )
+    {
+        return;
+    }
+
+    SDL_AtomicSet( &mIsRunning, 1 );
+    mThread = SDL_CreateThread( write, "CirionLogger", this );
+
+    if( mThread == NULL )
+    {
+        SDL_AtomicSet( &mIsRunning, 0 );
+        SDL_DestroySemaphore( mWake );
+        mWake = NULL;
+        return;
+    }
+
+    mCrashFd     = openCrashFile( crashPath );
+    gCrashLogger = this;
+
+    for( size_t i = 0; i != sizeof(gCrashSignals) / sizeof(int); i++ )
+    {
+        signal( gCrashSignals[i], flushOnCrash );
+    }
+}
+
+//! @brief Procédure d'arrêt du fil d'écriture.
+//!
+//! Les messages en attente sont tous écrits avant le retour; ceux publiés
+//! pendant l'arrêt sont abandonnés et comptés.
+void cirion::Logger::stop()
+{
+    if( SDL_AtomicGet( &mIsRunning ) == 0 )
+    {
+        return;
+    }
+
+    /* Les appelants suivants abandonnent leur message; ceux déjà engagés
+    dans push() le publient avant le dernier vidage. */
+    SDL_AtomicSet( &mIsStopping, 1 );
+
+    while( SDL_AtomicGet( &mPushers ) != 0 )
+    {
+        SDL_Delay( 1 );
+    }
+
+    SDL_AtomicSet( &mIsRunning, 0 );
+    SDL_SemPost( mWake );
+    SDL_WaitThread( mThread, NULL );
+    mThread = NULL;
+
+    // Messages publiés avant l'arrêt, et abandons.
+    flush();
+
+    SDL_DestroySemaphore( mWake );
+    mWake = NULL;
+
+    for( size_t i = 0; i != sizeof(gCrashSignals) / sizeof(int); i++ )
+    {
+        signal( gCrashSignals[i], SIG_DFL );
+    }
+
+    gCrashLogger = NULL;
+    closeCrashFile( mCrashFd );
+    mCrashFd = -1;
+    SDL_AtomicSet( &mIsStopping, 0 );
+}
+
+//! @brief Fonction de publication d'un message, depuis n'importe quel fil.
+//!
+//! Le message est la concaténation des morceaux, tronquée au delà de
+//! LOGGER_MAX_RECORD octets. Il est abandonné si l'anneau est plein.
+//! @param parts Les morceaux du message, terminés par un zéro.
+//! @param partCount Le nombre de morceaux, de 1 à 8; le dernier, court, est
+//! conservé même si le message est tronqué.
+//! @return Faux si le fil d'écriture est arrêté: l'appelant doit écrire le
+//! message lui-même.
+bool cirion::Logger::push( const char* const* parts, int partCount )
+{
+    bool isTaken;
+
+    // Compté, pour que stop() attende les publications engagées.
+    SDL_AtomicAdd( &mPushers, 1 );
+
+    if( SDL_AtomicGet( &mIsStopping ) != 0 )
+    {
+        SDL_AtomicAdd( &mDropped, 1 );
+        isTaken = true;
+    }
+
+    else
+    {
+        isTaken = publish( parts, partCount );
+    }
+
+    SDL_AtomicAdd( &mPushers, -1 );
+
+    return isTaken;
+}
+
+//! @brief Procédure d'écriture immédiate des messages publiés.
+void cirion::Logger::flush()
+{
+    SDL_AtomicLock( &mDrainLock );
+    drain();
+    SDL_AtomicUnlock( &mDrainLock );
+}
+
+//! @brief Fonction accesseur.
+//! @return Vrai si le fil d'écriture est actif.
+bool cirion::Logger::isRunning()
+{
+    return SDL_AtomicGet( &mIsRunning ) != 0;
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre de messages abandonnés, anneau plein ou arrêt en cours.
+Uint32 cirion::Logger::getDroppedCount()
+{
+    return (Uint32)SDL_AtomicGet( &mDropped );
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées.                                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Fonction de publication d'un message, hors arrêt.
+//! @param parts Les morceaux du message, terminés par un zéro.
+//! @param partCount Le nombre de morceaux, de 1 à 8.
+//! @return Faux si le fil d'écriture est arrêté.
+bool cirion::Logger::publish( const char* const* parts, int partCount )
+{
+    size_t lengths[8];
+    size_t size = 0;
+    size_t offset;
+    Uint32 header;
+    Uint32 position;
+    Uint32 count;
+
+    if(    SDL_AtomicGet( &mIsRunning ) == 0
+        || partCount < 1
+        || partCount > 8 )
+    {
+        return false;
+    }
+
+    // --- Taille du message, tronqué au besoin. -------------------------------
+    // Le dernier morceau, la fin du message, est toujours conservé.
+    lengths[partCount - 1] = strlen( parts[partCount - 1] );
+    size                   = lengths[partCount - 1];
+
+    for( int i = 0; i != partCount - 1; i++ )
+    {
+        lengths[i] = strlen( parts[i] );
+
+        if( size + lengths[i] > LOGGER_MAX_RECORD - sizeof(Uint32) )
+        {
+            lengths[i] = LOGGER_MAX_RECORD - sizeof(Uint32) - size;
+        }
+
+        size += lengths[i];
+    }
+
+    count = ( sizeof(Uint32) + size + LOGGER_SLOT_SIZE - 1 ) / LOGGER_SLOT_SIZE;
+
+    // --- Réservation des cases. ----------------------------------------------
+    /* L'écrivain libère les cases dans l'ordre: si la dernière est libre
+    pour ce tour de l'anneau, les précédentes le sont aussi. */
+    for( ;; )
+    {
+        Uint32 last;
+        Sint32 difference;
+
+        position   = (Uint32)SDL_AtomicGet( &mHead );
+        last       = position + count - 1;
+        difference = (Sint32)( (Uint32)SDL_AtomicGet( &mSequences[last & LOGGER_MASK] )
+                             - last );
+
+        if( difference == 0 )
+        {
+            if( SDL_AtomicCAS( &mHead, (int)position, (int)( position + count ) ) )
+            {
+                break;
+            }
+        }
+
+        // Anneau plein: l'appelant n'attend pas.
+        else if( difference < 0 )
+        {
+            SDL_AtomicAdd( &mDropped, 1 );
+            return true;
+        }
+    }
+
+    // --- Copie et publication. -----------------------------------------------
+    header = (Uint32)size;
+    offset = ( position & LOGGER_MASK ) * LOGGER_SLOT_SIZE;
+    offset = copyIn( offset, (const char*)&header, sizeof(Uint32) );
+
+    for( int i = 0; i != partCount; i++ )
+    {
+        offset = copyIn( offset, parts[i], lengths[i] );
+    }
+
+    /* Publication à rebours: la première case, que l'écrivain attend, est
+    publiée après toutes les autres. */
+    for( Uint32 i = count; i != 0; i-- )
+    {
+        SDL_AtomicSet( &mSequences[( position + i - 1 ) & LOGGER_MASK],
+                       (int)( position + i ) );
+    }
+
+    // Réveil de l'écrivain, s'il dort.
+    if(    SDL_AtomicGet( &mIsSleeping ) != 0
+        && SDL_AtomicCAS( &mIsSleeping, 1, 0 ) )
+    {
+        SDL_SemPost( mWake );
+    }
+
+    return true;
+}
+
+//! @brief Fonction principale du fil d'écriture.
+//! @param data Pointeur vers le journal.
+//! @return 0.
+int cirion::Logger::write( void* data )
+{
+    Logger* logger = (Logger*)data;
+
+    while( SDL_AtomicGet( &logger->mIsRunning ) != 0 )
+    {
+        logger->flush();
+
+        /* Les appelants ne réveillent qu'un écrivain endormi; l'anneau est
+        relu après l'annonce, pour ne pas manquer un message publié juste
+        avant. */
+        SDL_AtomicSet( &logger->mIsSleeping, 1 );
+
+        if(    logger->isEmpty()
+            && SDL_AtomicGet( &logger->mIsRunning ) != 0 )
+        {
+            SDL_SemWaitTimeout( logger->mWake, LOGGER_TIMEOUT );
+        }
+
+        SDL_AtomicSet( &logger->mIsSleeping, 0 );
+    }
+
+    logger->flush();
+
+    return 0;
+}
+
+//! @brief Procédure de vidage du journal sur signal fatal.
+//!
+//! Au mieux: si l'écrivain était en plein vidage, rien n'est écrit plutôt
+//! que de bloquer. Les messages, déjà formatés, sont écrits par write() sur
+//! le descripteur ouvert par start(): ni flux, ni allocation. Le signal est
+//! ensuite relevé avec son traîtement par défaut.
+//! @param signal Le signal reçu.
+void cirion::Logger::flushOnCrash( int signal )
+{
+    Logger* logger = gCrashLogger;
+
+    gCrashLogger = NULL;
+
+    if(    logger != NULL
+        && logger->mCrashFd >= 0
+        && SDL_AtomicTryLock( &logger->mDrainLock ) )
+    {
+        logger->drain( true );
+        SDL_AtomicUnlock( &logger->mDrainLock );
+    }
+
+    ::signal( signal, SIG_DFL );
+    raise( signal );
+}
+
+//! @brief Procédure d'écriture des messages publiés, verrou tenu.
+//! @param isCrashing Vrai sur signal fatal: les messages vont au descripteur
+//! de secours, sans passer par le flux.
+void cirion::Logger::drain( bool isCrashing )
+{
+    bool   isWritten = false;
+    Uint32 dropped;
+
+    while( !isEmpty() )
+    {
+        size_t offset = ( mTail & LOGGER_MASK ) * LOGGER_SLOT_SIZE;
+        size_t first;
+        Uint32 size;
+        Uint32 count;
+
+        // L'en-tête ne chevauche jamais la fin: les cases sont alignées.
+        memcpy( &size, mRing + offset, sizeof(Uint32) );
+        offset += sizeof(Uint32);
+        first   = size < LOGGER_RING_SIZE - offset
+                ? size
+                : LOGGER_RING_SIZE - offset;
+
+        if( isCrashing )
+        {
+            writeCrashFile( mCrashFd, mRing + offset, first );
+            writeCrashFile( mCrashFd, mRing, size - first );
+        }
+
+        else
+        {
+            mStream.write( mRing + offset, first );
+            mStream.write( mRing, size - first );
+        }
+
+        // Libération des cases pour le tour suivant.
+        count = ( sizeof(Uint32) + size + LOGGER_SLOT_SIZE - 1 ) / LOGGER_SLOT_SIZE;
+
+        for( Uint32 i = 0; i != count; i++ )
+        {
+            SDL_AtomicSet( &mSequences[( mTail + i ) & LOGGER_MASK],
+                           (int)( mTail + i + LOGGER_SLOTS ) );
+        }
+
+        mTail    += count;
+        isWritten = true;
+    }
+
+    // Le signalement des abandons passe par le flux.
+    if( isCrashing )
+    {
+        return;
+    }
+
+    // --- Signalement des messages abandonnés. --------------------------------
+    dropped = (Uint32)SDL_AtomicGet( &mDropped );
+
+    if( dropped != mReportedDrops )
+    {
+        mStream << "[INFO from "
+                << __PRETTY_FUNCTION__
+                << "]: \n"
+                << dropped - mReportedDrops
+                << " log message(s) dropped: queue full or logger stopping.\n\n";
+
+        mReportedDrops = dropped;
+        isWritten      = true;
+    }
+
+    if( isWritten )
+    {
+        mStream.flush();
+    }
+}
+
+//! @brief Fonction de test de l'anneau.
+//! @return Vrai si aucun message n'attend l'écrivain.
+bool cirion::Logger::isEmpty()
+{
+    return (Uint32)SDL_AtomicGet( &mSequences[mTail & LOGGER_MASK] ) != mTail + 1;
+}
+
+//! @brief Fonction de copie dans l'anneau, en repartant du début au besoin.
+//! @param offset La position de la copie, en octets.
+//! @param source Les octets à copier.
+//! @param size Le nombre d'octets.
+//! @return La position suivant la copie.
+size_t cirion::Logger::copyIn( size_t offset, const char* source, size_t size )
+{
+    size_t first = size < LOGGER_RING_SIZE - offset
+                 ? size
+                 : LOGGER_RING_SIZE - offset;
+
+    memcpy( mRing + offset, source, first );
+    memcpy( mRing, source + first, size - first );
+
+    return ( offset + size ) & ( LOGGER_RING_SIZE - 1 );
+}
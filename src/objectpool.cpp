@@ -0,0 +1,142 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    objectpool.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Réserves d'objets de taille fixe.
+ */
+
+#include <new>
+#include <Cirion/cirion.hpp>
+#include <Cirion/objectpool.hpp>
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe ObjectPool.
+//! @param objectSize La taille des objets, en octets.
+cirion::ObjectPool::ObjectPool( size_t objectSize ):
+    mFree      ( NULL ),
+    mObjectSize( objectSize ),
+    mLiveCount ( 0 )
+{
+    // L'emplacement libre doit pouvoir loger le chaînage, aligné.
+    if( mObjectSize < sizeof(void*) )
+    {
+        mObjectSize = sizeof(void*);
+    }
+
+    mObjectSize = ( mObjectSize + 15 ) & ~(size_t)15;
+}
+
+//! @brief Déstructeur pour la classe ObjectPool.
+cirion::ObjectPool::~ObjectPool()
+{
+    for( size_t i = 0; i != mChunks.size(); i++ )
+    {
+        delete[] mChunks[i];
+    }
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Fonction d'acquisition d'un emplacement.
+//! @param size La taille demandée par l'opérateur new.
+//! @return Pointeur vers l'emplacement.
+void* cirion::ObjectPool::acquire( size_t size )
+{
+    void* object;
+
+    if( size > mObjectSize )
+    {
+        return ::operator new( size );
+    }
+
+    if( mFree == NULL )
+    {
+        Uint8* chunk = new Uint8[mObjectSize * OBJECTPOOL_CHUNK_OBJECTS];
+
+        // Chaînage des emplacements du nouveau bloc.
+        for( size_t i = 0; i != OBJECTPOOL_CHUNK_OBJECTS; i++ )
+        {
+            *(void**)( chunk + i * mObjectSize ) = mFree;
+            mFree = chunk + i * mObjectSize;
+        }
+
+        mChunks.push_back( chunk );
+        gStats.objectPoolMisses++;
+    }
+
+    else
+    {
+        gStats.objectPoolHits++;
+    }
+
+    object = mFree;
+    mFree  = *(void**)object;
+    mLiveCount++;
+
+    return object;
+}
+
+//! @brief Procédure de restitution d'un emplacement.
+//! @param object Pointeur vers l'emplacement.
+//! @param size La taille passée par l'opérateur delete.
+void cirion::ObjectPool::release( void* object, size_t size )
+{
+    if( object == NULL )
+    {
+        return;
+    }
+
+    if( size > mObjectSize )
+    {
+        ::operator delete( object );
+        return;
+    }
+
+    *(void**)object = mFree;
+    mFree           = object;
+    mLiveCount--;
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre d'emplacements occupés.
+size_t cirion::ObjectPool::getLiveCount()
+{
+    return mLiveCount;
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre d'octets réservés par les blocs.
+size_t cirion::ObjectPool::getReservedSize()
+{
+    return mChunks.size() * mObjectSize * OBJECTPOOL_CHUNK_OBJECTS;
+}
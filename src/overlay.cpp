@@ -0,0 +1,231 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    overlay.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Incrustation des mesures de performance.
+ */
+
+#include <cstdio> // snprintf()
+#include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/framestats.hpp>
+#include <Cirion/log.hpp>
+#include <Cirion/overlay.hpp>
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe Overlay.
+cirion::Overlay::Overlay():
+    mIsCreated      ( false ),
+    mIsVisible      ( false ),
+    mDrawCalls      ( 0 ),
+    mTextureSwitches( 0 )
+{
+}
+
+//! @brief Déstructeur pour la classe Overlay.
+cirion::Overlay::~Overlay()
+{
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de création: chargement de la police et allocation du
+//!        lot, une fois pour toutes.
+//! @throw CiException en cas d'échec.
+void cirion::Overlay::create()
+{
+    mText.create( "TexCharset", OVERLAY_CAPACITY );
+    mIsCreated = true;
+}
+
+//! @brief Procédure de bascule de l'affichage.
+void cirion::Overlay::toggle()
+{
+    setVisible( !mIsVisible );
+}
+
+//! @brief Procédure mutateur.
+//! @param isVisible Vrai pour afficher l'incrustation.
+void cirion::Overlay::setVisible( bool isVisible )
+{
+    mIsVisible       = isVisible;
+    mDrawCalls       = gStats.drawCalls;
+    mTextureSwitches = gStats.textureSwitches;
+}
+
+//! @brief Fonction accesseur.
+//! @return Vrai si l'incrustation est affichée.
+bool cirion::Overlay::isVisible()
+{
+    return mIsVisible;
+}
+
+//! @brief Procédure de dessin, après l'image et avant sa présentation.
+//!
+//! Les appels de dessin et changements de texture sont ceux depuis le
+//! dernier affichage: une image entière, incrustation comprise.
+//! @throw CiException en cas d'échec.
+void cirion::Overlay::draw()
+{
+    FrameSummary frame;
+    SDL_Color    white;
+    char         line[64];
+    size_t       textures = 0;
+    int          y        = 2;
+
+    if( !mIsVisible || !mIsCreated )
+    {
+        return;
+    }
+
+    CIRION_PROFILE_ZONE( "Overlay::draw" );
+
+    frame   = gFrameStats.getWindowSummary();
+    white.r = 0xFF;
+    white.g = 0xFF;
+    white.b = 0xFF;
+    white.a = 0xFF;
+
+    for( size_t i = 0; i != gTextures.size(); i++ )
+    {
+        textures += gTextures[i]->isEvicted() ? 0 : 1;
+    }
+
+    mText.clear();
+
+    // --- Cadence et durées des images. ---------------------------------------
+    snprintf( line, sizeof(line), "%5.1f fps %6.2f ms p99 %6.2f max %6.2f",
+              frame.avg != 0 ? 1000000000.0 / frame.avg : 0.0,
+              frame.avg / 1000000.0,
+              frame.p99 / 1000000.0,
+              frame.max / 1000000.0 );
+    mText.print( 2, y, line, white );
+    y += TEXT_GLYPH_HEIGHT;
+
+    // --- Rendu. --------------------------------------------------------------
+    snprintf( line, sizeof(line), "Draws %4u  Texture switches %4u",
+              (unsigned int)( gStats.drawCalls - mDrawCalls ),
+              (unsigned int)( gStats.textureSwitches - mTextureSwitches ) );
+    mText.print( 2, y, line, white );
+    y += TEXT_GLYPH_HEIGHT;
+
+    // --- Objets. -------------------------------------------------------------
+    snprintf( line, sizeof(line), "Objects %5u  Game %4u  Particles %6u",
+              (unsigned int)gRegistry.getCount(),
+              (unsigned int)gGameObjects.size(),
+              (unsigned int)gParticleSystem.getCount() );
+    mText.print( 2, y, line, white );
+    y += TEXT_GLYPH_HEIGHT;
+
+    // --- Textures et rechargements. ------------------------------------------
+    snprintf( line, sizeof(line), "Textures %3u %6u KiB  Reloads %3u",
+              (unsigned int)textures,
+              (unsigned int)( gStats.textureMemory / 1024 ),
+              (unsigned int)gAssetWatcher.getPendingCount() );
+    mText.print( 2, y, line, white );
+    y += TEXT_GLYPH_HEIGHT + 2;
+
+    drawGraph( 2, y );
+    mText.draw();
+
+    mDrawCalls       = gStats.drawCalls;
+    mTextureSwitches = gStats.textureSwitches;
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées.                                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de composition du graphe des dernières durées d'images,
+//!        de la plus ancienne à la plus récente, à 1 pixel par ms. La ligne
+//!        marque la durée visée: vert en deçà, jaune jusqu'au double, rouge
+//!        au delà.
+//! @param x Abscisse du graphe.
+//! @param y Ordonnée du graphe.
+void cirion::Overlay::drawGraph( int x, int y )
+{
+    SDL_Rect  rect;
+    SDL_Color color;
+    Uint64    target = gFramePacer.getTargetRate() > 0
+                     ? 1000000000 / gFramePacer.getTargetRate()
+                     : 1000000000 / 60;
+
+    // Fond du graphe.
+    rect.x  = x;
+    rect.y  = y;
+    rect.w  = OVERLAY_GRAPH_FRAMES;
+    rect.h  = OVERLAY_GRAPH_HEIGHT;
+    color.r = 0x00;
+    color.g = 0x00;
+    color.b = 0x00;
+    color.a = 0xA0;
+    mText.fill( rect, color );
+
+    // Barres, une par image.
+    color.a = 0xFF;
+    rect.w  = 1;
+
+    for( size_t age = 0; age != OVERLAY_GRAPH_FRAMES; age++ )
+    {
+        Uint64 duration = gFrameStats.getRecent( age );
+        int    height   = (int)( duration / 1000000 );
+
+        if( duration == 0 )
+        {
+            break;
+        }
+
+        height  = height < 1 ? 1 : height;
+        height  = height > OVERLAY_GRAPH_HEIGHT ? OVERLAY_GRAPH_HEIGHT : height;
+        rect.x  = x + OVERLAY_GRAPH_FRAMES - 1 - (int)age;
+        rect.y  = y + OVERLAY_GRAPH_HEIGHT - height;
+        rect.h  = height;
+        color.r = duration > target + target / 10 ? 0xFF : 0x40;
+        color.g = duration > 2 * target ? 0x40 : 0xC0;
+        color.b = 0x40;
+        mText.fill( rect, color );
+    }
+
+    // Durée visée.
+    rect.x  = x;
+    rect.y  = target / 1000000 < OVERLAY_GRAPH_HEIGHT
+            ? y + OVERLAY_GRAPH_HEIGHT - (int)( target / 1000000 )
+            : y;
+    rect.w  = OVERLAY_GRAPH_FRAMES;
+    rect.h  = 1;
+    color.r = 0xFF;
+    color.g = 0xFF;
+    color.b = 0xFF;
+    color.a = 0x80;
+    mText.fill( rect, color );
+}
@@ -0,0 +1,698 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    particlesystem.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Système de particules en perspective.
+ */
+
+#include <sstream>
+#include <tinyxml2.h>
+#include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/log.hpp>
+#include <Cirion/particlesystem.hpp>
+#include <Cirion/texture.hpp>
+#include <Cirion/xmlerror.hpp>
+
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+
+using namespace std;
+using namespace cirion;
+using namespace tinyxml2;
+
+//! @brief Procédure de chargement de la description d'un émetteur.
+//! @param name Le nom de l'émetteur dans le répertoire des émetteurs.
+//! @param config La description à remplir.
+//! @throw CiException en cas d'échec.
+void cirion::loadEmitterConfig( const char* name, EmitterConfig& config )
+{
+    CIRION_PROFILE_ZONE( "loadEmitterConfig" );
+
+    ostringstream filepath;
+    XMLDocument   xml;
+    XMLElement*   emitterNode;
+    const char*   texture;
+
+    filepath << gWorkingDir
+             << "/Emitters/"
+             << name
+             << ".xml";
+
+    if( xml.LoadFile( filepath.str().c_str() ) != XML_NO_ERROR )
+    {
+        ostringstream oss;
+
+        oss << "Unable to load emitter \""
+            << name
+            << "\": "
+            << getXmlErrorStr( xml.ErrorID() );
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    emitterNode = xml.FirstChildElement( (const char*)"emitter" );
+
+    if( emitterNode == NULL )
+    {
+        throw CiException( "Unable to load emitter: Expected <emitter> node.",
+            __PRETTY_FUNCTION__ );
+    }
+
+    texture = emitterNode->Attribute( "texture" );
+
+    if( texture == NULL )
+    {
+        throw CiException( "Unable to load emitter: Expected texture attribute.",
+            __PRETTY_FUNCTION__ );
+    }
+
+    config.texture     = texture;
+    config.count       = emitterNode->IntAttribute( "count" );
+    config.frameWidth  = emitterNode->IntAttribute( "frameWidth" );
+    config.frameHeight = emitterNode->IntAttribute( "frameHeight" );
+    config.frames      = emitterNode->IntAttribute( "frames" );
+    config.spreadX     = emitterNode->FloatAttribute( "spreadX" );
+    config.spreadY     = emitterNode->FloatAttribute( "spreadY" );
+    config.depthMin    = emitterNode->FloatAttribute( "depthMin" );
+    config.depthMax    = emitterNode->FloatAttribute( "depthMax" );
+    config.depthReset  = emitterNode->FloatAttribute( "depthReset" );
+    config.speed       = emitterNode->FloatAttribute( "speed" );
+
+    // Une profondeur nulle rendrait la projection infinie.
+    if(    config.count <= 0
+        || config.frameWidth <= 0 || config.frameHeight <= 0
+        || config.frames < 0
+        || config.depthMin <= 0.0f || config.depthMax < config.depthMin
+        || config.depthReset <= 0.0f || config.speed < 0.0f )
+    {
+        throw CiException( "Unable to load emitter: Invalid attribute value.",
+            __PRETTY_FUNCTION__ );
+    }
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs de ParticleEmitter.        !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe ParticleEmitter.
+cirion::ParticleEmitter::ParticleEmitter():
+    mTexture     ( NULL ),
+    mTimeStep    ( 0.0f ),
+    mVisibleCount( 0 )
+{
+    mConfig.count = 0;
+}
+
+//! @brief Déstructeur pour la classe ParticleEmitter.
+cirion::ParticleEmitter::~ParticleEmitter()
+{
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques de ParticleEmitter.                 !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de création des particules.
+//! @param config La description de l'émetteur.
+//! @param texture La texture des particules, ou NULL.
+//! @param seed La graine du générateur, non nulle.
+void cirion::ParticleEmitter::create( const EmitterConfig& config,
+                                      Texture* texture, Uint32 seed )
+{
+    mConfig  = config;
+    mTexture = texture;
+    seed     = seed != 0 ? seed : 1;
+
+    if( mConfig.frames == 0 )
+    {
+        mConfig.frames = texture != NULL
+                       ? texture->getWidth() / mConfig.frameWidth
+                       : 1;
+    }
+
+    mX.resize( mConfig.count );
+    mY.resize( mConfig.count );
+    mZ.resize( mConfig.count );
+    mSeeds.resize( mConfig.count );
+    mScreenX.resize( mConfig.count );
+    mScreenY.resize( mConfig.count );
+    mFrames.resize( mConfig.count );
+    mVisibleCount = 0;
+
+    // Première génération, étalée en profondeur.
+    for( size_t i = 0; i != mZ.size(); i++ )
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        mSeeds[i] = seed;
+        spawn( i, true );
+    }
+}
+
+//! @brief Procédure de mise à jour des profondeurs, répartie sur les fils
+//! de travail par intervalles de PARTICLES_GRAIN particules.
+//! @param timeStep Temps écoulé depuis la dernière image.
+void cirion::ParticleEmitter::update( float timeStep )
+{
+    mTimeStep = timeStep;
+    gJobSystem.parallelFor( mZ.size(), PARTICLES_GRAIN, updateRange, this );
+}
+
+//! @brief Fonction de projection des particules à l'écran.
+//!
+//! Les positions projetées des particules visibles sont compactées dans
+//! les tableaux d'écran: l'écriture est inconditionnelle, seul le compteur
+//! avance selon la visibilité.
+//!
+//! La profondeur affichée est interpolée dans la dernière mise à jour; une
+//! particule régénérée part de sa nouvelle profondeur.
+//! @param alpha Fraction de mise à jour écoulée depuis la dernière, [0, 1].
+//! @return Le nombre de particules visibles.
+size_t cirion::ParticleEmitter::project( float alpha )
+{
+    float  width   = (float)mConfig.frameWidth;
+    float  height  = (float)mConfig.frameHeight;
+    float  centerX = (float)( gRendererWidth  - mConfig.frameWidth  ) / 2;
+    float  centerY = (float)( gRendererHeight - mConfig.frameHeight ) / 2;
+    float  back    = mConfig.speed * mTimeStep * ( 1.0f - alpha );
+    size_t count   = mZ.size();
+    size_t visible = 0;
+    size_t i       = 0;
+
+    #ifdef __SSE2__
+    __m128  one     = _mm_set1_ps( 1.0f );
+    __m128  offset  = _mm_set1_ps( back );
+    __m128  cx      = _mm_set1_ps( centerX );
+    __m128  cy      = _mm_set1_ps( centerY );
+    __m128  minX    = _mm_set1_ps( -width );
+    __m128  minY    = _mm_set1_ps( -height );
+    __m128  maxX    = _mm_set1_ps( (float)gRendererWidth );
+    __m128  maxY    = _mm_set1_ps( (float)gRendererHeight );
+    __m128i frames  = _mm_set1_epi32( mConfig.frames );
+    float   sx[4];
+    float   sy[4];
+    int     frame[4];
+
+    for( ; i + 4 <= count; i += 4 )
+    {
+        __m128  z       = _mm_add_ps( _mm_loadu_ps( &mZ[i] ), offset );
+        __m128  inverse = _mm_div_ps( one, z );
+        __m128  x       = _mm_add_ps( cx, _mm_mul_ps( _mm_loadu_ps( &mX[i] ), inverse ) );
+        __m128  y       = _mm_add_ps( cy, _mm_mul_ps( _mm_loadu_ps( &mY[i] ), inverse ) );
+        __m128i f       = _mm_cvttps_epi32( z );
+        __m128  inside  = _mm_and_ps( _mm_and_ps( _mm_cmpgt_ps( x, minX ),
+                                                  _mm_cmplt_ps( x, maxX ) ),
+                                      _mm_and_ps( _mm_cmpgt_ps( y, minY ),
+                                                  _mm_cmplt_ps( y, maxY ) ) );
+        int     mask    = _mm_movemask_ps( _mm_and_ps( inside,
+                              _mm_castsi128_ps( _mm_cmplt_epi32( f, frames ) ) ) );
+
+        _mm_storeu_ps( sx, x );
+        _mm_storeu_ps( sy, y );
+        _mm_storeu_si128( (__m128i*)frame, f );
+
+        for( int lane = 0; lane != 4; lane++ )
+        {
+            mScreenX[visible] = sx[lane];
+            mScreenY[visible] = sy[lane];
+            mFrames[visible]  = frame[lane];
+            visible          += ( mask >> lane ) & 1;
+        }
+    }
+    #endif // __SSE2__
+
+    for( ; i != count; i++ )
+    {
+        float z       = mZ[i] + back;
+        float inverse = 1.0f / z;
+        float x       = centerX + mX[i] * inverse;
+        float y       = centerY + mY[i] * inverse;
+        int   frame   = (int)z;
+
+        mScreenX[visible] = x;
+        mScreenY[visible] = y;
+        mFrames[visible]  = frame;
+        visible          += ( frame < mConfig.frames )
+                          & ( x > -width  ) & ( x < (float)gRendererWidth  )
+                          & ( y > -height ) & ( y < (float)gRendererHeight );
+    }
+
+    mVisibleCount = visible;
+
+    return visible;
+}
+
+//! @brief Fonction accesseur.
+//! @return La texture des particules.
+Texture* cirion::ParticleEmitter::getTexture()
+{
+    return mTexture;
+}
+
+//! @brief Fonction accesseur.
+//! @return La description de l'émetteur.
+const EmitterConfig& cirion::ParticleEmitter::getConfig()
+{
+    return mConfig;
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre de particules.
+size_t cirion::ParticleEmitter::getCount()
+{
+    return mZ.size();
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre de particules visibles à la dernière projection.
+size_t cirion::ParticleEmitter::getVisibleCount()
+{
+    return mVisibleCount;
+}
+
+//! @brief Fonction accesseur.
+//! @return Les abscisses projetées des particules visibles.
+const float* cirion::ParticleEmitter::getScreenX()
+{
+    return mScreenX.empty() ? NULL : &mScreenX[0];
+}
+
+//! @brief Fonction accesseur.
+//! @return Les ordonnées projetées des particules visibles.
+const float* cirion::ParticleEmitter::getScreenY()
+{
+    return mScreenY.empty() ? NULL : &mScreenY[0];
+}
+
+//! @brief Fonction accesseur.
+//! @return Les images des particules visibles.
+const int* cirion::ParticleEmitter::getFrames()
+{
+    return mFrames.empty() ? NULL : &mFrames[0];
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées de ParticleEmitter.                   !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de mise à jour d'un intervalle, pour le système de
+//! tâches.
+//! @param data Pointeur vers l'émetteur.
+//! @param first La première particule.
+//! @param last Après la dernière particule.
+void cirion::ParticleEmitter::updateRange( void* data, size_t first, size_t last )
+{
+    ( (ParticleEmitter*)data )->advance( first, last );
+}
+
+//! @brief Procédure d'avancement des profondeurs d'un intervalle.
+//!
+//! Les profondeurs sont avancées par quatre; les particules ayant atteint
+//! la caméra sont régénérées une à une, ce qui reste rare.
+//! @param first La première particule.
+//! @param last Après la dernière particule.
+void cirion::ParticleEmitter::advance( size_t first, size_t last )
+{
+    float  step = mConfig.speed * mTimeStep;
+    size_t i    = first;
+
+    #ifdef __SSE2__
+    __m128 steps = _mm_set1_ps( step );
+    __m128 zero  = _mm_setzero_ps();
+
+    for( ; i + 4 <= last; i += 4 )
+    {
+        __m128 z    = _mm_sub_ps( _mm_loadu_ps( &mZ[i] ), steps );
+        int    mask = _mm_movemask_ps( _mm_cmple_ps( z, zero ) );
+
+        _mm_storeu_ps( &mZ[i], z );
+
+        for( int lane = 0; mask != 0; lane++, mask >>= 1 )
+        {
+            if( mask & 1 )
+            {
+                spawn( i + lane, false );
+            }
+        }
+    }
+    #endif // __SSE2__
+
+    for( ; i != last; i++ )
+    {
+        mZ[i] -= step;
+
+        if( mZ[i] <= 0.0f )
+        {
+            spawn( i, false );
+        }
+    }
+}
+
+//! @brief Procédure de (ré)génération d'une particule.
+//! @param i L'indice de la particule.
+//! @param randomDepth Indique le tirage d'une profondeur aléatoire.
+void cirion::ParticleEmitter::spawn( size_t i, bool randomDepth )
+{
+    mZ[i] = randomDepth
+          ? mConfig.depthMin + random( i ) * ( mConfig.depthMax - mConfig.depthMin )
+          : mConfig.depthReset;
+    mX[i] = ( random( i ) - 0.5f ) * mConfig.spreadX;
+    mY[i] = ( random( i ) - 0.5f ) * mConfig.spreadY;
+}
+
+//! @brief Fonction de tirage pseudo-aléatoire (xorshift32).
+//! @param i L'indice de la particule, dont le générateur avance.
+//! @return Un nombre dans [0, 1[.
+float cirion::ParticleEmitter::random( size_t i )
+{
+    Uint32 seed = mSeeds[i];
+
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    mSeeds[i] = seed;
+
+    return (float)( seed >> 8 ) * ( 1.0f / 16777216.0f );
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs de ParticleSystem.         !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe ParticleSystem.
+cirion::ParticleSystem::ParticleSystem():
+    mSeed( 0x2545F491 )
+{
+}
+
+//! @brief Déstructeur pour la classe ParticleSystem.
+cirion::ParticleSystem::~ParticleSystem()
+{
+    clear();
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques de ParticleSystem.                  !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Fonction d'ajout d'un émetteur décrit dans le répertoire des
+//! émetteurs.
+//! @param name Le nom de l'émetteur.
+//! @return Pointeur vers l'émetteur.
+//! @throw CiException en cas d'échec.
+ParticleEmitter* cirion::ParticleSystem::add( const char* name )
+{
+    EmitterConfig config;
+    Texture*      texture;
+
+    try
+    {
+        loadEmitterConfig( name, config );
+        texture = getTexture( config.texture.c_str() );
+    }
+
+    catch( CiException const& e )
+    {
+        log( e );
+        throw CiException( "Unable to add the requested emitter.",
+            __PRETTY_FUNCTION__ );
+    }
+
+    return add( config, texture );
+}
+
+//! @brief Fonction d'ajout d'un émetteur.
+//!
+//! L'émetteur est placé après ceux de la même texture, pour qu'elle soit
+//! dessinée en un seul lot.
+//! @param config La description de l'émetteur.
+//! @param texture La texture des particules, ou NULL.
+//! @return Pointeur vers l'émetteur.
+ParticleEmitter* cirion::ParticleSystem::add( const EmitterConfig& config,
+                                              Texture* texture )
+{
+    ParticleEmitter* emitter  = new ParticleEmitter();
+    size_t           position = mEmitters.size();
+
+    // Une graine par émetteur: deux émetteurs identiques ne se superposent pas.
+    emitter->create( config, texture,
+        mSeed ^ (Uint32)( ( mEmitters.size() + 1 ) * 0x9E3779B9 ) );
+
+    for( size_t i = 0; i != mEmitters.size(); i++ )
+    {
+        if( mEmitters[i]->getTexture() == texture )
+        {
+            position = i + 1;
+        }
+    }
+
+    mEmitters.insert( mEmitters.begin() + position, emitter );
+
+    return emitter;
+}
+
+//! @brief Procédure de suppression des émetteurs.
+void cirion::ParticleSystem::clear()
+{
+    for( size_t i = 0; i != mEmitters.size(); i++ )
+    {
+        delete mEmitters[i];
+    }
+
+    mEmitters.clear();
+    mBatches.clear();
+}
+
+//! @brief Procédure de choix de la graine des émetteurs à venir.
+//!
+//! Chaque émetteur tire la sienne de cette graine et de son rang: une
+//! partie rejouée avec la même graine refait les mêmes particules.
+//! @param seed La graine, non nulle.
+void cirion::ParticleSystem::setSeed( Uint32 seed )
+{
+    mSeed = seed != 0 ? seed : 1;
+}
+
+//! @brief Procédure de mise à jour des émetteurs.
+//! @param timeStep Temps écoulé depuis la dernière image.
+void cirion::ParticleSystem::update( float timeStep )
+{
+    CIRION_PROFILE_ZONE( "ParticleSystem::update" );
+
+    for( size_t i = 0; i != mEmitters.size(); i++ )
+    {
+        mEmitters[i]->update( timeStep );
+    }
+}
+
+//! @brief Fonction de préparation des lots de l'image.
+//!
+//! Chaque émetteur est projeté; les particules visibles sont converties en
+//! quads texturés, regroupés par texture.
+//! @param alpha Fraction de mise à jour écoulée depuis la dernière, [0, 1].
+//! @return Le nombre de particules visibles.
+size_t cirion::ParticleSystem::prepare( float alpha )
+{
+    size_t total = 0;
+
+    mBatches.clear();
+
+    for( size_t i = 0; i != mEmitters.size(); i++ )
+    {
+        ParticleEmitter* emitter = mEmitters[i];
+        size_t           visible = emitter->project( alpha );
+
+        if( visible == 0 )
+        {
+            continue;
+        }
+
+        if( mBatches.empty() || mBatches.back().texture != emitter->getTexture() )
+        {
+            ParticleBatch batch;
+
+            batch.texture = emitter->getTexture();
+            batch.first   = total;
+            batch.count   = 0;
+            mBatches.push_back( batch );
+        }
+
+        #ifdef PARTICLES_GEOMETRY
+        const EmitterConfig& config  = emitter->getConfig();
+        Texture*             texture = emitter->getTexture();
+        const float*         x       = emitter->getScreenX();
+        const float*         y       = emitter->getScreenY();
+        const int*           frames  = emitter->getFrames();
+        float                width   = (float)config.frameWidth;
+        float                height  = (float)config.frameHeight;
+        float                du      = texture != NULL && texture->getWidth() != 0
+                                     ? width / (float)texture->getWidth()
+                                     : 1.0f / (float)config.frames;
+        float                dv      = texture != NULL && texture->getHeight() != 0
+                                     ? height / (float)texture->getHeight()
+                                     : 1.0f;
+
+        // Les tampons ne font que grandir: pas d'allocation en régime établi.
+        if( mVertices.size() < ( total + visible ) * 4 )
+        {
+            SDL_Vertex white;
+
+            white.color.r = 255;
+            white.color.g = 255;
+            white.color.b = 255;
+            white.color.a = 255;
+            mVertices.resize( ( total + visible ) * 4, white );
+        }
+
+        while( mIndices.size() < ( total + visible ) * 6 )
+        {
+            int first = (int)( mIndices.size() / 6 * 4 );
+
+            mIndices.push_back( first );
+            mIndices.push_back( first + 1 );
+            mIndices.push_back( first + 2 );
+            mIndices.push_back( first + 2 );
+            mIndices.push_back( first + 1 );
+            mIndices.push_back( first + 3 );
+        }
+
+        SDL_Vertex* vertex = &mVertices[ total * 4 ];
+
+        for( size_t j = 0; j != visible; j++, vertex += 4 )
+        {
+            float u = (float)frames[j] * du;
+
+            vertex[0].position.x  = x[j];
+            vertex[0].position.y  = y[j];
+            vertex[0].tex_coord.x = u;
+            vertex[0].tex_coord.y = 0.0f;
+            vertex[1].position.x  = x[j] + width;
+            vertex[1].position.y  = y[j];
+            vertex[1].tex_coord.x = u + du;
+            vertex[1].tex_coord.y = 0.0f;
+            vertex[2].position.x  = x[j];
+            vertex[2].position.y  = y[j] + height;
+            vertex[2].tex_coord.x = u;
+            vertex[2].tex_coord.y = dv;
+            vertex[3].position.x  = x[j] + width;
+            vertex[3].position.y  = y[j] + height;
+            vertex[3].tex_coord.x = u + du;
+            vertex[3].tex_coord.y = dv;
+        }
+        #endif // PARTICLES_GEOMETRY
+
+        mBatches.back().count += visible;
+        total                 += visible;
+    }
+
+    return total;
+}
+
+//! @brief Procédure de dessin des particules, un lot par texture.
+//! @param alpha Fraction de mise à jour écoulée depuis la dernière, [0, 1].
+void cirion::ParticleSystem::draw( float alpha )
+{
+    CIRION_PROFILE_ZONE( "ParticleSystem::draw" );
+
+    prepare( alpha );
+
+    #ifdef PARTICLES_GEOMETRY
+
+    for( size_t i = 0; i != mBatches.size(); i++ )
+    {
+        ParticleBatch& batch = mBatches[i];
+
+        renderGeometry( batch.texture != NULL ? batch.texture->bind() : NULL,
+                        &mVertices[ batch.first * 4 ],
+                        (int)( batch.count * 4 ),
+                        &mIndices[0],
+                        (int)( batch.count * 6 ) );
+    }
+
+    #else
+
+    // Sans SDL_RenderGeometry(), une copie par particule.
+    for( size_t i = 0; i != mEmitters.size(); i++ )
+    {
+        ParticleEmitter*     emitter = mEmitters[i];
+        const EmitterConfig& config  = emitter->getConfig();
+        SDL_Texture*         texture;
+        SDL_Rect             src;
+        SDL_Rect             dest;
+
+        if( emitter->getVisibleCount() == 0 || emitter->getTexture() == NULL )
+        {
+            continue;
+        }
+
+        texture = emitter->getTexture()->bind();
+        src.y   = 0;
+        src.w   = config.frameWidth;
+        src.h   = config.frameHeight;
+        dest.w  = config.frameWidth;
+        dest.h  = config.frameHeight;
+
+        for( size_t j = 0; j != emitter->getVisibleCount(); j++ )
+        {
+            src.x  = emitter->getFrames()[j] * config.frameWidth;
+            dest.x = (int)emitter->getScreenX()[j];
+            dest.y = (int)emitter->getScreenY()[j];
+            renderCopy( texture, &src, &dest );
+        }
+    }
+
+    #endif // PARTICLES_GEOMETRY
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre total de particules.
+size_t cirion::ParticleSystem::getCount()
+{
+    size_t count = 0;
+
+    for( size_t i = 0; i != mEmitters.size(); i++ )
+    {
+        count += mEmitters[i]->getCount();
+    }
+
+    return count;
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre de lots préparés pour la dernière image.
+size_t cirion::ParticleSystem::getBatchCount()
+{
+    return mBatches.size();
+}
+
+//! @brief Fonction accesseur.
+//! @return La graine des émetteurs.
+Uint32 cirion::ParticleSystem::getSeed()
+{
+    return mSeed;
+}
@@ -0,0 +1,170 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    pixelpool.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Réserve de tampons de pixels.
+ */
+
+#include <cstdlib>
+#include <Cirion/cirion.hpp>
+#include <Cirion/pixelpool.hpp>
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe PixelPool.
+cirion::PixelPool::PixelPool():
+    mReservedSize( 0 ),
+    mLock        ( 0 )
+{
+}
+
+//! @brief Déstructeur pour la classe PixelPool.
+cirion::PixelPool::~PixelPool()
+{
+    clear();
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Fonction d'obtention d'un tampon.
+//!
+//! Un tampon plus grand que la plus grande classe est alloué directement,
+//! et compté comme un échec.
+//! @param size Taille minimale du tampon, en octets.
+//! @return Pointeur vers le tampon, ou NULL si l'allocation échoue.
+void* cirion::PixelPool::acquire( size_t size )
+{
+    int   sizeClass = getClass( size );
+    void* buffer;
+
+    SDL_AtomicLock( &mLock );
+
+    if( sizeClass != -1 && !mFree[sizeClass].empty() )
+    {
+        buffer = mFree[sizeClass].back();
+        mFree[sizeClass].pop_back();
+        gStats.pixelPoolHits++;
+        SDL_AtomicUnlock( &mLock );
+
+        return buffer;
+    }
+
+    gStats.pixelPoolMisses++;
+    SDL_AtomicUnlock( &mLock );
+
+    if( sizeClass == -1 )
+    {
+        return malloc( size );
+    }
+
+    buffer = malloc( (size_t)1 << ( PIXELPOOL_MIN_SHIFT + sizeClass ) );
+
+    if( buffer != NULL )
+    {
+        SDL_AtomicLock( &mLock );
+        mReservedSize += (size_t)1 << ( PIXELPOOL_MIN_SHIFT + sizeClass );
+        SDL_AtomicUnlock( &mLock );
+    }
+
+    return buffer;
+}
+
+//! @brief Procédure de restitution d'un tampon.
+//! @param buffer Le tampon obtenu par acquire().
+//! @param size La taille demandée lors de l'obtention.
+void cirion::PixelPool::release( void* buffer, size_t size )
+{
+    int sizeClass = getClass( size );
+
+    if( buffer == NULL )
+    {
+        return;
+    }
+
+    if( sizeClass == -1 )
+    {
+        free( buffer );
+        return;
+    }
+
+    SDL_AtomicLock( &mLock );
+    mFree[sizeClass].push_back( buffer );
+    SDL_AtomicUnlock( &mLock );
+}
+
+//! @brief Procédure de libération des tampons libres.
+//!
+//! Les tampons encore obtenus restent à la charge de leur détenteur.
+void cirion::PixelPool::clear()
+{
+    SDL_AtomicLock( &mLock );
+
+    for( int i = 0; i != PIXELPOOL_CLASSES; i++ )
+    {
+        for( size_t j = 0; j != mFree[i].size(); j++ )
+        {
+            free( mFree[i][j] );
+            mReservedSize -= (size_t)1 << ( PIXELPOOL_MIN_SHIFT + i );
+        }
+
+        mFree[i].clear();
+    }
+
+    SDL_AtomicUnlock( &mLock );
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre d'octets réservés par la réserve, libres ou obtenus.
+size_t cirion::PixelPool::getReservedSize()
+{
+    return mReservedSize;
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées.                                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Fonction de calcul de la classe de taille d'un tampon.
+//! @param size Taille du tampon, en octets.
+//! @return L'indice de la classe, ou -1 si le tampon est trop grand.
+int cirion::PixelPool::getClass( size_t size )
+{
+    for( int i = 0; i != PIXELPOOL_CLASSES; i++ )
+    {
+        if( size <= (size_t)1 << ( PIXELPOOL_MIN_SHIFT + i ) )
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
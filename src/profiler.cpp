@@ -0,0 +1,366 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    profiler.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Zones de profilage et export de traces Chrome.
+ */
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/log.hpp>
+#include <Cirion/profiler.hpp>
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs de Profiler.               !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe Profiler.
+cirion::Profiler::Profiler():
+    mTls            ( 0 ),
+    mRequestedFrames( 0 ),
+    mRemainingFrames( 0 ),
+    mStartCounter   ( 0 )
+{
+    for( int i = 0; i != PROFILER_MAX_THREADS; i++ )
+    {
+        mBuffers[i] = NULL;
+    }
+
+    SDL_AtomicSet( &mBufferCount, 0 );
+    SDL_AtomicSet( &mIsCapturing, 0 );
+}
+
+//! @brief Déstructeur pour la classe Profiler.
+cirion::Profiler::~Profiler()
+{
+    for( int i = 0; i != PROFILER_MAX_THREADS; i++ )
+    {
+        delete mBuffers[i];
+    }
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques de Profiler.                        !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de demande d'une trace, à partir de la prochaine image.
+//!        Doit être appelée par le fil principal.
+//! @param frames Le nombre d'images à tracer.
+//! @param filepath Le fichier JSON de la trace.
+void cirion::Profiler::capture( int frames, const char* filepath )
+{
+    #ifdef PROFILE
+
+    ostringstream oss;
+
+    if( frames <= 0 || isCapturing() )
+    {
+        return;
+    }
+
+    if( mTls == 0 )
+    {
+        mTls = SDL_TLSCreate();
+    }
+
+    // Le premier tampon revient au fil principal.
+    getBuffer();
+
+    mRequestedFrames = frames;
+    mFilepath        = filepath;
+
+    oss << "Tracing "
+        << frames
+        << " frame(s) to \""
+        << filepath
+        << "\".";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+
+    #else
+
+    log( "Profiling is disabled in this build: rebuild with PROFILE=1.",
+        __PRETTY_FUNCTION__ );
+
+    #endif // PROFILE
+}
+
+//! @brief Procédure de marquage du début d'une image, par le fil principal.
+//!        Démarre une trace demandée, ou écrit la trace achevée.
+void cirion::Profiler::frame()
+{
+    ProfileEvent event;
+
+    event.name  = "Frame";
+    event.start = SDL_GetPerformanceCounter();
+    event.end   = event.start;
+    event.type  = PROFILE_FRAME;
+
+    if( isCapturing() )
+    {
+        record( event );
+
+        if( --mRemainingFrames == 0 )
+        {
+            SDL_AtomicSet( &mIsCapturing, 0 );
+            write();
+        }
+    }
+
+    else if( mRequestedFrames > 0 )
+    {
+        // Les fils de travail sont inactifs entre deux images.
+        for( int i = 0; i != PROFILER_MAX_THREADS; i++ )
+        {
+            if( mBuffers[i] != NULL )
+            {
+                SDL_AtomicSet( &mBuffers[i]->written, 0 );
+            }
+        }
+
+        mStartCounter    = event.start;
+        mRemainingFrames = mRequestedFrames;
+        mRequestedFrames = 0;
+        SDL_AtomicSet( &mIsCapturing, 1 );
+        record( event );
+    }
+}
+
+//! @brief Procédure d'enregistrement d'une zone.
+//! @param name Le nom de la zone, chaîne statique.
+//! @param start Compteur haute résolution à l'entrée.
+//! @param end Compteur haute résolution à la sortie.
+void cirion::Profiler::zone( const char* name, Uint64 start, Uint64 end )
+{
+    ProfileEvent event;
+
+    if( !isCapturing() )
+    {
+        return;
+    }
+
+    event.name  = name;
+    event.start = start;
+    event.end   = end;
+    event.type  = PROFILE_ZONE;
+    record( event );
+}
+
+//! @brief Procédure d'enregistrement de la valeur d'un compteur.
+//! @param name Le nom du compteur, chaîne statique.
+//! @param value La valeur.
+void cirion::Profiler::counter( const char* name, double value )
+{
+    ProfileEvent event;
+
+    if( !isCapturing() )
+    {
+        return;
+    }
+
+    event.name  = name;
+    event.start = SDL_GetPerformanceCounter();
+    event.value = value;
+    event.type  = PROFILE_COUNTER;
+    record( event );
+}
+
+//! @brief Fonction accesseur.
+//! @return Vrai si une trace est en cours.
+bool cirion::Profiler::isCapturing()
+{
+    return SDL_AtomicGet( &mIsCapturing ) != 0;
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées de Profiler.                          !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Fonction d'accès au tampon du fil courant, attribué au premier
+//!        appel.
+//! @return Le tampon, NULL si tous les tampons sont attribués.
+ProfileBuffer* cirion::Profiler::getBuffer()
+{
+    ProfileBuffer* buffer = (ProfileBuffer*)SDL_TLSGet( mTls );
+    int            index;
+
+    if( buffer != NULL || SDL_AtomicGet( &mBufferCount ) >= PROFILER_MAX_THREADS )
+    {
+        return buffer;
+    }
+
+    index = SDL_AtomicAdd( &mBufferCount, 1 );
+
+    if( index >= PROFILER_MAX_THREADS )
+    {
+        return NULL;
+    }
+
+    buffer = new ProfileBuffer;
+    SDL_AtomicSet( &buffer->written, 0 );
+    SDL_TLSSet( mTls, buffer, NULL );
+    mBuffers[index] = buffer;
+
+    return buffer;
+}
+
+//! @brief Procédure d'écriture d'un évenement dans le tampon du fil courant.
+//!        Un tampon plein écrase ses plus anciens évenements.
+//! @param event L'évenement.
+void cirion::Profiler::record( const ProfileEvent& event )
+{
+    ProfileBuffer* buffer = getBuffer();
+    int            written;
+
+    if( buffer == NULL )
+    {
+        return;
+    }
+
+    written = SDL_AtomicGet( &buffer->written );
+    buffer->events[ written % PROFILER_BUFFER_SIZE ] = event;
+    SDL_AtomicSet( &buffer->written, written + 1 );
+}
+
+//! @brief Procédure d'écriture de la trace au format JSON des traces Chrome.
+void cirion::Profiler::write()
+{
+    ofstream      file( mFilepath.c_str() );
+    ostringstream oss;
+    double        scale  = 1000000.0 / (double)SDL_GetPerformanceFrequency();
+    size_t        count  = 0;
+    size_t        lost   = 0;
+    int           threads;
+
+    if( !file.is_open() )
+    {
+        oss << "Unable to write the trace \""
+            << mFilepath
+            << "\".";
+
+        log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+        return;
+    }
+
+    threads = SDL_AtomicGet( &mBufferCount );
+    threads = threads < PROFILER_MAX_THREADS ? threads : PROFILER_MAX_THREADS;
+
+    file.setf( ios::fixed );
+    file.precision( 3 );
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    for( int tid = 0; tid != threads; tid++ )
+    {
+        ProfileBuffer* buffer  = mBuffers[tid];
+        int            written = buffer != NULL ? SDL_AtomicGet( &buffer->written ) : 0;
+        int            first   = written > PROFILER_BUFFER_SIZE
+                               ? written - PROFILER_BUFFER_SIZE
+                               : 0;
+
+        file << ( tid == 0 ? "\n" : ",\n" )
+             << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+             << tid
+             << ",\"args\":{\"name\":\""
+             << ( tid == 0 ? "Main thread" : "Worker thread" )
+             << "\"}}";
+
+        lost += first;
+
+        for( int i = first; i < written; i++ )
+        {
+            const ProfileEvent& event = buffer->events[ i % PROFILER_BUFFER_SIZE ];
+            double              ts    = (double)( event.start - mStartCounter ) * scale;
+
+            file << ",\n{\"name\":\""
+                 << event.name
+                 << "\",\"pid\":1,\"tid\":"
+                 << tid
+                 << ",\"ts\":"
+                 << ts;
+
+            switch( event.type )
+            {
+                case PROFILE_ZONE:
+                file << ",\"ph\":\"X\",\"dur\":"
+                     << (double)( event.end - event.start ) * scale
+                     << "}";
+                break;
+
+                case PROFILE_COUNTER:
+                file << ",\"ph\":\"C\",\"args\":{\"value\":"
+                     << event.value
+                     << "}}";
+                break;
+
+                case PROFILE_FRAME:
+                file << ",\"ph\":\"i\",\"s\":\"g\"}";
+                break;
+            }
+        }
+
+        count += written - first;
+    }
+
+    file << "\n]}\n";
+
+    oss << "Trace written to \""
+        << mFilepath
+        << "\": "
+        << count
+        << " event(s) from "
+        << threads
+        << " thread(s), "
+        << lost
+        << " overwritten.";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs de ProfileZone.            !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe ProfileZone.
+//! @param name Le nom de la zone, chaîne statique.
+cirion::ProfileZone::ProfileZone( const char* name ):
+    mName ( name ),
+    mStart( gProfiler.isCapturing() ? SDL_GetPerformanceCounter() : 0 )
+{
+}
+
+//! @brief Déstructeur pour la classe ProfileZone.
+cirion::ProfileZone::~ProfileZone()
+{
+    if( mStart != 0 )
+    {
+        gProfiler.zone( mName, mStart, SDL_GetPerformanceCounter() );
+    }
+}
@@ -0,0 +1,316 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    prototype.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Prototypes d'entités partagés.
+ */
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <Cirion/cef.hpp>
+#include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/entity.hpp>
+#include <Cirion/log.hpp>
+#include <Cirion/prototype.hpp>
+#include <Cirion/texture.hpp>
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe EntityPrototype.
+cirion::EntityPrototype::EntityPrototype():
+    mInstanceCount( 0 )
+{
+}
+
+//! @brief Déstructeur pour la classe EntityPrototype.
+cirion::EntityPrototype::~EntityPrototype()
+{
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de chargement du prototype.
+//! @param name Nom de l'entité dans le répertoire des entités.
+//! @throw CiException en cas d'échec.
+void cirion::EntityPrototype::load( const char* name )
+{
+    CIRION_PROFILE_ZONE( "EntityPrototype::load" );
+
+    mCef.load( name );
+    mName = name;
+}
+
+//! @brief Procédure de rechargement du prototype et de ses instances.
+//!
+//! Le nouveau XML est chargé à part, puis vérifié contre les instances
+//! vivantes: chaque sprite doit encore exister et chaque texture se
+//! charger. En cas d'échec (entité en cours d'édition, faute de frappe),
+//! rien n'est modifié. Sinon, les données sont échangées et les anciennes
+//! gardées en vie le temps de re-pointer toutes les instances, en une
+//! passe qui ne lève pas d'exception.
+//! @throw CiException en cas d'échec.
+void cirion::EntityPrototype::reload()
+{
+    Cef             cef;
+    vector<Entity*> instances;
+
+    cef.load( mName.c_str() );
+
+    // --- Recherche des instances. --------------------------------------------
+    for( size_t i = 0; i != gGameObjects.size(); i++ )
+    {
+        Entity* entity = dynamic_cast<Entity*>( gGameObjects[i] );
+
+        if( entity != NULL && entity->getPrototype() == this )
+        {
+            instances.push_back( entity );
+        }
+    }
+
+    /* Une instance hors de gGameObjects garderait des pointeurs vers les
+    anciennes données. */
+    if( instances.size() != mInstanceCount )
+    {
+        ostringstream oss;
+
+        oss << "Unable to reload entity \""
+            << mName
+            << "\": "
+            << mInstanceCount - instances.size()
+            << " instance(s) out of reach.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    // --- Vérification des sprites utilisés. ----------------------------------
+    for( size_t i = 0; i != instances.size(); i++ )
+    {
+        const char* missing = instances[i]->findMissingSprite( cef );
+
+        if( missing != NULL )
+        {
+            ostringstream oss;
+
+            oss << "Unable to reload entity \""
+                << mName
+                << "\": sprite \""
+                << missing
+                << "\" is in use but no longer exists.";
+
+            throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+        }
+    }
+
+    // --- Chargement des textures, pour que la recréation n'échoue pas. ------
+    for( size_t i = 0; i != cef.getSprites().size(); i++ )
+    {
+        getTexture( cef.getSprites()[i].spritesheet );
+    }
+
+    // --- Échange, puis recréation des sprites. -------------------------------
+    // Les anciennes données vivent dans cef jusqu'au retour.
+    mCef.swap( cef );
+
+    for( size_t i = 0; i != instances.size(); i++ )
+    {
+        instances[i]->reload();
+    }
+}
+
+//! @brief Procédure de comptage d'une nouvelle instance.
+void cirion::EntityPrototype::acquire()
+{
+    mInstanceCount++;
+}
+
+//! @brief Procédure de décomptage d'une instance détruite.
+void cirion::EntityPrototype::release()
+{
+    if( mInstanceCount != 0 )
+    {
+        mInstanceCount--;
+    }
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nom de l'entité.
+const char* cirion::EntityPrototype::getName()
+{
+    return mName.c_str();
+}
+
+//! @brief Fonction accesseur.
+//! @param name Le nom du sprite.
+//! @return Pointeur vers les données partagées du sprite, ou NULL.
+SpriteData* cirion::EntityPrototype::getSprite( const char* name )
+{
+    return mCef.getSprite( name );
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre d'instances vivantes.
+unsigned int cirion::EntityPrototype::getInstanceCount()
+{
+    return mInstanceCount;
+}
+
+//! @brief Fonction de calcul de la mémoire occupée par les données partagées.
+//! @return La taille en octets.
+size_t cirion::EntityPrototype::getSharedSize()
+{
+    vector<SpriteData>& sprites = mCef.getSprites();
+    size_t              size    = sizeof(EntityPrototype) + mName.capacity();
+
+    size += sprites.capacity() * sizeof(SpriteData);
+
+    for( size_t i = 0; i != sprites.size(); i++ )
+    {
+        size += sprites[i].animations.capacity() * sizeof(Animation);
+
+        for( size_t j = 0; j != sprites[i].animations.size(); j++ )
+        {
+            size += sprites[i].animations[j].frames.capacity() * sizeof(Frame);
+        }
+    }
+
+    return size;
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des fonctions du registre.                                 !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Fonction de recherche d'un prototype dans le registre.
+//! @param name Nom de l'entité.
+//! @return Pointeur vers le prototype, ou NULL s'il n'est pas chargé.
+EntityPrototype* cirion::findPrototype( const char* name )
+{
+    for( size_t i = 0; i != gPrototypes.size(); i++ )
+    {
+        if( strcmp( gPrototypes[i]->getName(), name ) == 0 )
+        {
+            return gPrototypes[i];
+        }
+    }
+
+    return NULL;
+}
+
+//! @brief Fonction d'obtention d'un prototype, chargé au premier appel.
+//! @param name Nom de l'entité dans le répertoire des entités.
+//! @return Pointeur vers le prototype.
+//! @throw CiException en cas d'échec.
+EntityPrototype* cirion::getPrototype( const char* name )
+{
+    EntityPrototype* prototype = findPrototype( name );
+
+    if( prototype != NULL )
+    {
+        return prototype;
+    }
+
+    prototype = new EntityPrototype();
+
+    try
+    {
+        prototype->load( name );
+    }
+
+    catch( CiException const& e )
+    {
+        log( e );
+        delete prototype;
+
+        throw CiException( "Unable to load the requested entity prototype.",
+            __PRETTY_FUNCTION__ );
+    }
+
+    gPrototypes.push_back( prototype );
+
+    return prototype;
+}
+
+//! @brief Procédure de report de la mémoire des prototypes et des instances.
+void cirion::logPrototypes()
+{
+    ostringstream oss;
+
+    oss << gPrototypes.size()
+        << " entity prototype(s):";
+
+    for( size_t i = 0; i != gPrototypes.size(); i++ )
+    {
+        size_t instanceSize = 0;
+
+        // Mémoire des instances vivantes de ce prototype.
+        for( size_t j = 0; j != gGameObjects.size(); j++ )
+        {
+            Entity* entity = dynamic_cast<Entity*>( gGameObjects[j] );
+
+            if( entity != NULL && entity->getPrototype() == gPrototypes[i] )
+            {
+                instanceSize += entity->getInstanceSize();
+            }
+        }
+
+        oss << endl
+            << "\""
+            << gPrototypes[i]->getName()
+            << "\"\t: "
+            << gPrototypes[i]->getSharedSize()
+            << " bytes shared by "
+            << gPrototypes[i]->getInstanceCount()
+            << " instance(s), "
+            << ( gPrototypes[i]->getInstanceCount() != 0
+               ? instanceSize / gPrototypes[i]->getInstanceCount()
+               : 0 )
+            << " bytes per instance";
+    }
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
+
+//! @brief Procédure de libération des prototypes.
+//!
+//! Les instances doivent avoir été détruites.
+void cirion::freePrototypes()
+{
+    for( size_t i = 0; i != gPrototypes.size(); i++ )
+    {
+        delete gPrototypes[i];
+    }
+
+    gPrototypes.clear();
+}
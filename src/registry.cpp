@@ -0,0 +1,418 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    registry.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Stockage des composants des objets en tableaux compacts.
+ */
+
+#include <algorithm>
+#include <vector>
+#include <Cirion/animationsystem.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/registry.hpp>
+#include <Cirion/texture.hpp>
+
+using namespace std;
+using namespace cirion;
+
+//! @brief Fonction de comparaison de deux images par rang de dessin.
+static bool isDrawnBefore( const DrawCommand& lhs, const DrawCommand& rhs )
+{
+    return lhs.order < rhs.order;
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe Registry.
+cirion::Registry::Registry():
+    mNextId   ( 0 ),
+    mNextOrder( 0 ),
+    mTimeStep ( 0.0f )
+{
+}
+
+//! @brief Déstructeur pour la classe Registry.
+cirion::Registry::~Registry()
+{
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Fonction de création d'un objet, sans composant.
+//! @return L'identifiant de l'objet.
+ObjectId cirion::Registry::create()
+{
+    ObjectId id;
+
+    if( !mFreeIds.empty() )
+    {
+        id = mFreeIds.back();
+        mFreeIds.pop_back();
+    }
+
+    else
+    {
+        id = mNextId++;
+    }
+
+    return id;
+}
+
+//! @brief Procédure de destruction d'un objet et de tous ses composants.
+//! @param id L'identifiant de l'objet.
+void cirion::Registry::destroy( ObjectId id )
+{
+    mTransforms.remove( id );
+    mVelocities.remove( id );
+    mRenderables.remove( id );
+    mAttachments.remove( id );
+    mAnimations.remove( id );
+    mFreeIds.push_back( id );
+}
+
+//! @brief Procédure de destruction de tous les objets.
+void cirion::Registry::clear()
+{
+    mTransforms.clear();
+    mVelocities.clear();
+    mRenderables.clear();
+    mAttachments.clear();
+    mAnimations.clear();
+    mDrawList.clear();
+    mFreeIds.clear();
+    mNextId    = 0;
+    mNextOrder = 0;
+}
+
+//! @brief Procédure de mémorisation des positions, au début d'une mise à
+//!        jour: le rendu interpole entre elles et les nouvelles positions.
+void cirion::Registry::storePositions()
+{
+    gJobSystem.parallelFor( mTransforms.getCount(), REGISTRY_GRAIN,
+                            storeRange, this );
+}
+
+//! @brief Procédure de déplacement des objets selon leur vitesse.
+//! @param timeStep Temps écoulé depuis la dernière mise à jour, en ms.
+void cirion::Registry::updateMotion( float timeStep )
+{
+    CIRION_PROFILE_ZONE( "Registry::updateMotion" );
+
+    mTimeStep = timeStep;
+    gJobSystem.parallelFor( mVelocities.getCount(), REGISTRY_GRAIN,
+                            moveRange, this );
+}
+
+//! @brief Procédure de placement des objets rattachés sur leur parent.
+//!
+//! Un seul niveau de rattachement: le parent d'un objet rattaché ne doit
+//! pas lui-même être rattaché.
+void cirion::Registry::updateAttachments()
+{
+    gJobSystem.parallelFor( mAttachments.getCount(), REGISTRY_GRAIN,
+                            attachRange, this );
+}
+
+//! @brief Procédure de placement immédiat d'un objet et de ses rattachés.
+//!
+//! Les positions de départ sont placées aussi: le rendu n'interpole pas
+//! depuis l'ancienne position (création, téléportation).
+//! @param id L'objet à placer.
+//! @param position Sa nouvelle position.
+void cirion::Registry::warp( ObjectId id, const Point2f& position )
+{
+    Transform& transform = mTransforms.get( id );
+
+    transform.position = position;
+    transform.previous = position;
+
+    for( size_t i = 0; i != mAttachments.getCount(); i++ )
+    {
+        const Attachment& attachment = mAttachments.at( i );
+
+        if( attachment.parent == id )
+        {
+            Transform& child = mTransforms.get( mAttachments.getId( i ) );
+
+            child.position.mX = position.mX + attachment.relative.mX;
+            child.position.mY = position.mY + attachment.relative.mY;
+            child.previous    = child.position;
+        }
+    }
+}
+
+//! @brief Procédure de recopie des images avancées par gAnimationSystem.
+void cirion::Registry::updateRenderables()
+{
+    gJobSystem.parallelFor( mAnimations.getCount(), REGISTRY_GRAIN,
+                            copyFramesRange, this );
+}
+
+//! @brief Fonction de construction de la liste des images visibles.
+//!
+//! Seul le rectangle rogné est copié, décalé d'autant dans la cellule. Les
+//! images étant réparties au hasard à l'écran, le test de visibilité ne
+//! branche pas: chaque image est écrite, et le curseur n'avance que si elle
+//! est visible.
+//!
+//! La position affichée est interpolée entre celle du début et celle de la
+//! fin de la dernière mise à jour.
+//! @param origin L'origine du repère d'affichage.
+//! @param alpha Fraction de mise à jour écoulée depuis la dernière, [0, 1].
+//! @return Le nombre d'images visibles, en tête de liste, triées par rang.
+size_t cirion::Registry::cull( const Point2f& origin, float alpha )
+{
+    size_t count    = 0;
+    bool   isSorted = true;
+    size_t visible;
+
+    if( mDrawList.size() < mRenderables.getCount() )
+    {
+        mDrawList.resize( mRenderables.getCount() );
+    }
+
+    for( size_t i = 0; i != mRenderables.getCount(); i++ )
+    {
+        const Renderable& renderable = mRenderables.at( i );
+        const Transform&  transform
+            = mTransforms.get( mRenderables.getId( i ) );
+        DrawCommand&      command    = mDrawList[count];
+        float             x          = transform.previous.mX + alpha
+                                     * ( transform.position.mX - transform.previous.mX );
+        float             y          = transform.previous.mY + alpha
+                                     * ( transform.position.mY - transform.previous.mY );
+
+        command.texture = renderable.texture;
+        command.src     = renderable.src;
+        command.dest.x  = (int)( x - origin.mX ) + renderable.offset.mX;
+        command.dest.y  = (int)( y - origin.mY ) + renderable.offset.mY;
+        command.dest.w  = renderable.src.w;
+        command.dest.h  = renderable.src.h;
+        command.order   = renderable.order;
+
+        // L'objet est-il visible ?
+        visible = ( renderable.texture != NULL )
+                & ( command.dest.x < gRendererWidth )
+                & ( command.dest.y < gRendererHeight )
+                & ( command.dest.x + command.dest.w > 0 )
+                & ( command.dest.y + command.dest.h > 0 );
+
+        isSorted &= visible == 0
+                 || count == 0
+                 || mDrawList[count - 1].order < command.order;
+        count    += visible;
+    }
+
+    /* Les retraits déplacent des images dans le tableau compact: l'ordre de
+    dessin est rétabli, au besoin seulement. */
+    if( !isSorted )
+    {
+        sort( mDrawList.begin(), mDrawList.begin() + count, isDrawnBefore );
+    }
+
+    return count;
+}
+
+//! @brief Procédure de dessin des objets visibles, dans l'ordre de création
+//!        de leurs images.
+//! @param origin L'origine du repère d'affichage.
+//! @param alpha Fraction de mise à jour écoulée depuis la dernière, [0, 1].
+void cirion::Registry::draw( const Point2f& origin, float alpha )
+{
+    size_t count = cull( origin, alpha );
+
+    for( size_t i = 0; i != count; i++ )
+    {
+        renderCopy( mDrawList[i].texture->bind(),
+                    &mDrawList[i].src,
+                    &mDrawList[i].dest );
+    }
+}
+
+//! @brief Fonction accesseur.
+//! @return Les positions des objets.
+ComponentPool<Transform>& cirion::Registry::getTransforms()
+{
+    return mTransforms;
+}
+
+//! @brief Fonction accesseur.
+//! @return Les vitesses des objets.
+ComponentPool<Velocity>& cirion::Registry::getVelocities()
+{
+    return mVelocities;
+}
+
+//! @brief Fonction accesseur.
+//! @return Les images des objets.
+ComponentPool<Renderable>& cirion::Registry::getRenderables()
+{
+    return mRenderables;
+}
+
+//! @brief Fonction accesseur.
+//! @return Les rattachements des objets.
+ComponentPool<Attachment>& cirion::Registry::getAttachments()
+{
+    return mAttachments;
+}
+
+//! @brief Fonction accesseur.
+//! @return Les poignées gAnimationSystem des objets animés.
+ComponentPool<int>& cirion::Registry::getAnimations()
+{
+    return mAnimations;
+}
+
+//! @brief Fonction d'attribution du rang de dessin d'une nouvelle image.
+//! @return Le rang, croissant avec l'ordre de création.
+Uint32 cirion::Registry::getNextOrder()
+{
+    return mNextOrder++;
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre d'objets vivants.
+size_t cirion::Registry::getCount()
+{
+    return mNextId - mFreeIds.size();
+}
+
+//! @brief Fonction de test de mouvement.
+//! @return Vrai si un objet a une vitesse non nulle.
+bool cirion::Registry::isMoving()
+{
+    for( size_t i = 0; i != mVelocities.getCount(); i++ )
+    {
+        const Point2f& velocity = mVelocities.at( i ).velocity;
+
+        if( velocity.mX != 0.0f || velocity.mY != 0.0f )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//! @brief Fonction de calcul de la mémoire occupée par un sprite: position,
+//!        image, rattachement et animation.
+//! @return La taille en octets, hors capacité inutilisée des tableaux.
+size_t cirion::Registry::getSlotSize()
+{
+    return sizeof(Transform) + sizeof(Renderable) + sizeof(Attachment)
+         + sizeof(int) + 4 * ( sizeof(int) + sizeof(ObjectId) );
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées.                                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de mémorisation d'un intervalle des positions, pour le
+//! système de tâches.
+//! @param data Pointeur vers le registre.
+//! @param first La première position.
+//! @param last Après la dernière position.
+void cirion::Registry::storeRange( void* data, size_t first, size_t last )
+{
+    Registry* registry = (Registry*)data;
+
+    for( size_t i = first; i != last; i++ )
+    {
+        Transform& transform = registry->mTransforms.at( i );
+
+        transform.previous = transform.position;
+    }
+}
+
+//! @brief Procédure de déplacement d'un intervalle des vitesses, pour le
+//! système de tâches. Chaque vitesse n'écrit que la position de son objet.
+//! @param data Pointeur vers le registre.
+//! @param first La première vitesse.
+//! @param last Après la dernière vitesse.
+void cirion::Registry::moveRange( void* data, size_t first, size_t last )
+{
+    Registry* registry = (Registry*)data;
+    float     step     = registry->mTimeStep;
+
+    for( size_t i = first; i != last; i++ )
+    {
+        Point2f& position = registry->mTransforms.get(
+                            registry->mVelocities.getId( i ) ).position;
+        Point2f& velocity = registry->mVelocities.at( i ).velocity;
+
+        position.mX += velocity.mX * step;
+        position.mY += velocity.mY * step;
+    }
+}
+
+//! @brief Procédure de placement d'un intervalle des rattachements, pour le
+//! système de tâches. Les parents n'étant pas rattachés, aucune position lue
+//! n'est écrite par une autre tâche.
+//! @param data Pointeur vers le registre.
+//! @param first Le premier rattachement.
+//! @param last Après le dernier rattachement.
+void cirion::Registry::attachRange( void* data, size_t first, size_t last )
+{
+    Registry* registry = (Registry*)data;
+
+    for( size_t i = first; i != last; i++ )
+    {
+        const Attachment& attachment = registry->mAttachments.at( i );
+
+        if( attachment.parent == OBJECT_NONE )
+        {
+            continue;
+        }
+
+        registry->mTransforms.get( registry->mAttachments.getId( i ) ).position
+            = registry->mTransforms.get( attachment.parent ).position
+            + attachment.relative;
+    }
+}
+
+//! @brief Procédure de recopie d'un intervalle des images, pour le système
+//! de tâches.
+//! @param data Pointeur vers le registre.
+//! @param first La première poignée d'animation.
+//! @param last Après la dernière poignée d'animation.
+void cirion::Registry::copyFramesRange( void* data, size_t first, size_t last )
+{
+    Registry* registry = (Registry*)data;
+
+    for( size_t i = first; i != last; i++ )
+    {
+        Renderable& renderable = registry->mRenderables.get(
+                                 registry->mAnimations.getId( i ) );
+        int         handle     = registry->mAnimations.at( i );
+
+        renderable.src    = gAnimationSystem.getSrc( handle );
+        renderable.offset = gAnimationSystem.getOffset( handle );
+    }
+}
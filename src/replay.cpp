@@ -0,0 +1,417 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    replay.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Enregistrement et relecture des entrées.
+ */
+
+#include <cstdlib> // srand()
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/log.hpp>
+#include <Cirion/replay.hpp>
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe Replay.
+cirion::Replay::Replay():
+    mRun        ( 0 ),
+    mRunTick    ( 0 ),
+    mTick       ( 0 ),
+    mChecksum   ( 0 ),
+    mIsRecording( false ),
+    mIsPlaying  ( false ),
+    mIsRealTime ( false ),
+    mIsFinished ( false )
+{
+    memset( &mHeader, 0x00, sizeof(CrpHeader) );
+}
+
+//! @brief Déstructeur pour la classe Replay.
+cirion::Replay::~Replay()
+{
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de démarrage d'un enregistrement.
+//!
+//! Les générateurs sont réamorcés avec la graine enregistrée: à appeler
+//! avant la création du monde et des objets.
+//! @param filepath Chemin vers le fichier, écrit par stop().
+void cirion::Replay::record( const char* filepath )
+{
+    ostringstream oss;
+
+    memset( &mHeader, 0x00, sizeof(CrpHeader) );
+    mHeader.magic   = CRP_MAGIC;
+    mHeader.version = CRP_VERSION;
+    mHeader.seed    = gParticleSystem.getSeed();
+    mFilepath       = filepath;
+    mRuns.clear();
+    mTick           = 0;
+    mIsRecording    = true;
+    mIsPlaying      = false;
+    mIsFinished     = false;
+    seed();
+
+    oss << "Recording input to \""
+        << filepath
+        << "\", seed 0x"
+        << hex
+        << mHeader.seed
+        << ".";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
+
+//! @brief Procédure de démarrage d'une relecture.
+//!
+//! Comme record(), à appeler avant la création du monde et des objets.
+//! @param filepath Chemin vers le fichier.
+//! @param isRealTime Vrai pour rejouer au rythme de l'horloge, faux pour
+//! enchaîner un pas par image, sans attente.
+//! @throw CiException en cas d'échec.
+void cirion::Replay::play( const char* filepath, bool isRealTime )
+{
+    ostringstream oss;
+    ifstream      file( filepath, ios::binary | ios::in );
+    size_t        size = 0;
+
+    if( !file.is_open() )
+    {
+        oss << "Unable to load replay \""
+            << filepath
+            << "\": unable to open file.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    file.seekg( 0, ios::end );
+    size = (size_t)file.tellg();
+    file.seekg( 0, ios::beg );
+    file.read( (char*)&mHeader, sizeof(CrpHeader) );
+
+    if(    !file
+        || mHeader.magic   != CRP_MAGIC
+        || mHeader.version != CRP_VERSION
+        || mHeader.rate    == 0
+        || size - sizeof(CrpHeader) != mHeader.runCount * sizeof(Uint32) )
+    {
+        oss << "Unable to load replay \""
+            << filepath
+            << "\": invalid or truncated file.";
+
+        memset( &mHeader, 0x00, sizeof(CrpHeader) );
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    mRuns.resize( mHeader.runCount );
+
+    if( mHeader.runCount != 0 )
+    {
+        file.read( (char*)&mRuns[0], mHeader.runCount * sizeof(Uint32) );
+    }
+
+    file.close();
+
+    mFilepath    = filepath;
+    mRun         = 0;
+    mRunTick     = 0;
+    mTick        = 0;
+    mChecksum    = 0;
+    mIsRecording = false;
+    mIsPlaying   = true;
+    mIsRealTime  = isRealTime;
+    mIsFinished  = false;
+    seed();
+
+    oss << "Replaying "
+        << mHeader.tickCount
+        << " tick(s) at "
+        << mHeader.rate
+        << " Hz from \""
+        << filepath
+        << "\", "
+        << ( isRealTime ? "in real time" : "as fast as possible" )
+        << ".";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
+
+//! @brief Procédure d'arrêt de l'enregistrement ou de la relecture.
+//!
+//! L'enregistrement est écrit sur le disque avec la somme de contrôle de
+//! l'état courant; la relecture compare la sienne à celle enregistrée.
+//! @throw CiException si l'enregistrement ne peut être écrit.
+void cirion::Replay::stop()
+{
+    ostringstream oss;
+
+    // --- Fin d'enregistrement. -----------------------------------------------
+    if( mIsRecording )
+    {
+        mIsRecording      = false;
+        mHeader.tickCount = mTick;
+        mHeader.runCount  = mRuns.size();
+        mHeader.checksum  = computeChecksum();
+        write();
+
+        oss << "Recorded "
+            << mTick
+            << " tick(s) in "
+            << mRuns.size()
+            << " segment(s) to \""
+            << mFilepath
+            << "\".";
+
+        log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    // --- Fin de relecture. ---------------------------------------------------
+    if( mIsPlaying )
+    {
+        mIsPlaying = false;
+
+        if( !mIsFinished )
+        {
+            oss << "Replay interrupted after "
+                << mTick
+                << " of "
+                << mHeader.tickCount
+                << " tick(s).";
+        }
+
+        else if( mChecksum == mHeader.checksum )
+        {
+            oss << "Replay of "
+                << mTick
+                << " tick(s) matched the recording.";
+        }
+
+        else
+        {
+            oss << "Replay diverged from the recording: checksum 0x"
+                << hex
+                << mChecksum
+                << ", expected 0x"
+                << mHeader.checksum
+                << ".";
+        }
+
+        log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+}
+
+//! @brief Fonction de passage d'un pas de simulation.
+//!
+//! Appelée à chaque échantillonnage des actions: l'état est ajouté à
+//! l'enregistrement, ou remplacé par celui de la relecture. La fin de la
+//! relecture arrête la boucle principale.
+//! @param state L'état des actions, un bit par action.
+//! @return L'état à simuler.
+Uint32 cirion::Replay::next( Uint32 state )
+{
+    Uint32 mask = ( 1 << CRP_STATE_BITS ) - 1;
+
+    // --- Enregistrement: les pas identiques allongent le dernier segment. ----
+    if( mIsRecording )
+    {
+        state &= mask;
+
+        if(    !mRuns.empty()
+            && ( mRuns.back() & mask ) == state
+            && ( mRuns.back() >> CRP_STATE_BITS ) < CRP_MAX_RUN )
+        {
+            mRuns.back() += 1 << CRP_STATE_BITS;
+        }
+
+        else
+        {
+            mRuns.push_back( state | 1 << CRP_STATE_BITS );
+        }
+
+        mTick++;
+        return state;
+    }
+
+    if( !mIsPlaying )
+    {
+        return state;
+    }
+
+    if( mIsFinished )
+    {
+        return 0;
+    }
+
+    // --- Relecture épuisée: l'état est celui de la fin d'enregistrement. -----
+    if( mRun == mRuns.size() )
+    {
+        mChecksum   = computeChecksum();
+        mIsFinished = true;
+        gIsRunning  = false;
+        return 0;
+    }
+
+    state = mRuns[mRun] & mask;
+
+    if( ++mRunTick == mRuns[mRun] >> CRP_STATE_BITS )
+    {
+        mRun++;
+        mRunTick = 0;
+    }
+
+    mTick++;
+    return state;
+}
+
+//! @brief Procédure d'enregistrement de la fréquence de simulation.
+//! @param rate La fréquence, en Hz.
+void cirion::Replay::setRate( int rate )
+{
+    if( mIsRecording )
+    {
+        mHeader.rate = rate;
+    }
+}
+
+//! @brief Fonction accesseur.
+//! @return La fréquence de simulation enregistrée, en Hz, 0 sinon.
+int cirion::Replay::getRate()
+{
+    return mHeader.rate;
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre de pas enregistrés ou relus.
+Uint32 cirion::Replay::getTickCount()
+{
+    return mTick;
+}
+
+//! @brief Fonction accesseur.
+//! @return Vrai si un enregistrement est en cours.
+bool cirion::Replay::isRecording()
+{
+    return mIsRecording;
+}
+
+//! @brief Fonction accesseur.
+//! @return Vrai si une relecture est en cours.
+bool cirion::Replay::isPlaying()
+{
+    return mIsPlaying;
+}
+
+//! @brief Fonction accesseur.
+//! @return Vrai si la relecture suit l'horloge.
+bool cirion::Replay::isRealTime()
+{
+    return mIsRealTime;
+}
+
+//! @brief Fonction accesseur.
+//! @return Vrai si la relecture est achevée.
+bool cirion::Replay::isFinished()
+{
+    return mIsFinished;
+}
+
+//! @brief Fonction de calcul de la somme de contrôle des positions.
+//!
+//! FNV-1a sur les identifiants et les positions des objets de gRegistry.
+//! @return La somme de contrôle.
+Uint32 cirion::Replay::computeChecksum()
+{
+    ComponentPool<Transform>& transforms = gRegistry.getTransforms();
+    Uint32                    hash       = 2166136261u;
+
+    for( size_t i = 0; i != transforms.getCount(); i++ )
+    {
+        Uint32 words[3];
+
+        words[0] = transforms.getId( i );
+        memcpy( &words[1], &transforms.at( i ).position.mX, sizeof(Uint32) );
+        memcpy( &words[2], &transforms.at( i ).position.mY, sizeof(Uint32) );
+
+        for( size_t j = 0; j != sizeof(words); j++ )
+        {
+            hash ^= ( (const Uint8*)words )[j];
+            hash *= 16777619u;
+        }
+    }
+
+    return hash;
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées.                                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure d'écriture de l'enregistrement sur le disque.
+//! @throw CiException en cas d'échec.
+void cirion::Replay::write()
+{
+    ostringstream oss;
+    fstream       file;
+
+    file.open( mFilepath.c_str(), ios::binary | ios::out | ios::trunc );
+
+    if( !file.is_open() )
+    {
+        oss << "Unable to write replay \""
+            << mFilepath
+            << "\": unable to create output file.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    file.write( (const char*)&mHeader, sizeof(CrpHeader) );
+
+    if( !mRuns.empty() )
+    {
+        file.write( (const char*)&mRuns[0], mRuns.size() * sizeof(Uint32) );
+    }
+
+    file.close();
+}
+
+//! @brief Procédure d'amorçage des générateurs avec la graine de l'en-tête.
+void cirion::Replay::seed()
+{
+    srand( mHeader.seed );
+    gParticleSystem.setSeed( mHeader.seed );
+}
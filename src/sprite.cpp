@@ -26,27 +26,36 @@
  * @brief   Manipulation des sprites.
  */
 
+#include <cstring>
 #include <sstream>
-#include <tinyxml2.h>
+#include <Cirion/animationsystem.hpp>
 #include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/collisionsystem.hpp>
 #include <Cirion/gameobject.hpp>
 #include <Cirion/log.hpp>
 #include <Cirion/point2.hpp>
+#include <Cirion/registry.hpp>
 #include <Cirion/sprite.hpp>
+#include <Cirion/statemachine.hpp>
 
 using namespace cirion;
 using namespace std;
-using namespace tinyxml2;
 
 //! @brief Constructeur pour la classe Sprite.
 cirion::Sprite::Sprite():
-    mRelative( Point2f( 0.0f, 0.0f ) ),
     mCollidable( false ),
-    mFacingRight( false ),
-    mEleapsed( 0 ),
-    mFrameIndex( 0 ),
-    mAnimation( NULL )
+    mData( NULL ),
+    mAnimationHandle( -1 ),
+    mCollisionHandle( -1 ),
+    mStateFlags( NULL )
 {
+    Attachment attachment;
+
+    attachment.parent   = OBJECT_NONE;
+    attachment.relative = Point2f( 0.0f, 0.0f );
+    gRegistry.getAttachments().add( mId, attachment );
+
     mHitbox.x = 0;
     mHitbox.y = 0;
     mHitbox.w = 0;
@@ -56,36 +65,33 @@ cirion::Sprite::Sprite():
 //! @brief Déstructeur pour la classe Sprite.
 cirion::Sprite::~Sprite()
 {
+    if( mAnimationHandle != -1 )
+    {
+        gAnimationSystem.remove( mAnimationHandle );
+    }
+
+    if( mCollisionHandle != -1 )
+    {
+        gCollisionSystem.remove( mCollisionHandle );
+    }
+
+    gStateMachines.remove( mId );
 }
 
 //! @brief Procédure de création d'un sprite.
-//! @param *spriteNode Pointeur vers un noeud XML <sprite>.
+//! @param data Les données du sprite, partagées par le prototype de l'entité:
+//!             elles doivent survivre au sprite.
 //! @throw CiException en cas d'échec.
-void cirion::Sprite::create( XMLElement* spriteNode )
+void cirion::Sprite::create( const SpriteData& data )
 {
-    // Si le sprite à déjà été crée ?
+    mData = &data;
 
-    XMLElement* hitboxNode;
-    XMLElement* animationNode;
-    XMLElement* frameNode;
-    XMLElement* leftNode;
-    XMLElement* rightNode;
-    Animation   animation;
-    Frame       frame;
-
-    if( spriteNode == NULL )
-    {
-        ostringstream oss;
-
-        oss << "Unable to fetch sprite data: "
-            << "Given <sprite> node is NULL.";
-
-        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
-    }
+    // Récuperation du nom du sprite.
+    mName = data.name;
 
     try
     {
-        setTexture( spriteNode->Attribute( (const char*)"spritesheet" ) );
+        setTexture( data.spritesheet );
     }
 
     catch( CiException const& e )
@@ -95,154 +101,77 @@ void cirion::Sprite::create( XMLElement* spriteNode )
         throw CiException( (const char*)"Unable to process sprite creation.",
             __PRETTY_FUNCTION__ );
     }
-	
-	// Définition des dimensions du sprite.
-	mSrc.w  = spriteNode->IntAttribute( (const char*)"src_w" );
-	mSrc.h  = spriteNode->IntAttribute( (const char*)"src_h" );
-    mDest.w = mSrc.w;
-    mDest.h = mSrc.h;
-    //cout << "mSrc.w = " << mSrc.w << endl
-    //     << "mSrc.h = " << mSrc.h << endl;
-
-    // Récuperation du noeud <hitbox>
-    hitboxNode = spriteNode->FirstChildElement( (const char*)"hitbox" );
-
-    if( hitboxNode == NULL )
-    {
-        ostringstream oss;
-
-        oss << "Unable to fetch sprite data: "
-            << "Expected <hitbox> node.";
-
-        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
-    }
 
-    mHitbox.x = hitboxNode->IntAttribute( (const char*)"x" );
-    mHitbox.y = hitboxNode->IntAttribute( (const char*)"y" );
-    mHitbox.w = hitboxNode->IntAttribute( (const char*)"w" );
-    mHitbox.h = hitboxNode->IntAttribute( (const char*)"h" );
-    //cout << "mHitbox.x = " << mHitbox.x << endl
-    //     << "mHitbox.y = " << mHitbox.y << endl
-    //     << "mHitbox.w = " << mHitbox.w << endl
-    //     << "mHitbox.h = " << mHitbox.h << endl;
+    // Définition des dimensions du sprite.
+    setSrc( 0, 0, data.srcW, data.srcH );
 
-    // Récuperation du 1er noeud <animation>.
-    animationNode = spriteNode->FirstChildElement( (const char*)"animation" );
+    // Définition de la hitbox: seul un sprite avec une hitbox est un corps.
+    mHitbox     = data.hitbox;
+    mCollidable = mHitbox.w > 0 && mHitbox.h > 0;
 
-    if( animationNode == NULL )
+    if( mCollidable && mCollisionHandle == -1 )
     {
-        ostringstream oss;
-
-        oss << "Unable to fetch sprite data: "
-            << "Expected <animation> node.";
-
-        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+        mCollisionHandle = gCollisionSystem.add( this, mHitbox );
     }
 
-    // --- Parcours de tous les noeuds <animation>. ----------------------------
-    while( animationNode != NULL )
+    else if( mCollidable )
     {
-        animation.frames.clear();
-
-        // Récuperation du nom de l'animation.
-        animation.name = animationNode->Attribute( "name" );
-        //cout << "animation.name = " << animation.name << endl;
-
-        // Récuperation du noeud <frame>.
-        frameNode = animationNode->FirstChildElement( "frame" );
-
-        if( frameNode == NULL )
-        {
-            ostringstream oss;
-
-            oss << "Unable to fetch sprite data: "
-                << "Expected <frame> node.";
-
-            throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
-        }
-
-        // --- Parcours de tous les noeuds <frame>. ----------------------------
-        while( frameNode != NULL )
-        {
-            // Récuperation de la durée d'affichage de l'image.
-            frame.duration = frameNode->IntAttribute( "duration" );
-            //cout << "frame.duration = " << frame.duration << endl;
-
-            // Récuperation du noeud <left>.
-            leftNode = frameNode->FirstChildElement( "left" );
-
-            if( leftNode == NULL )
-            {
-                ostringstream oss;
-
-                oss << "Unable to fetch sprite data: "
-                    << "Expected <left> node.";
-
-                throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
-            }
-
-            // Récuperation des coordonnées sources du fragment gauche.
-            frame.left.mX = leftNode->IntAttribute( "src_x" );
-            frame.left.mY = leftNode->IntAttribute( "src_y" );
-            //cout << "frame.left.mX = " << frame.left.mX << endl
-            //     << "frame.left.mY = " << frame.left.mY << endl;
-
-            // Récuperation du noeud <right>.
-            rightNode = frameNode->FirstChildElement( "right" );
-
-            if( rightNode == NULL )
-            {
-                ostringstream oss;
-
-                oss << "Unable to fetch sprite data: "
-                    << "Expected <right> node.";
-
-                throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
-            }
+        gCollisionSystem.setHitbox( mCollisionHandle, mHitbox );
+    }
 
-            // Récuperation des coordonnées sources du fragment droit.
-            frame.right.mX = rightNode->IntAttribute( "src_x" );
-            frame.right.mY = rightNode->IntAttribute( "src_y" );
-            //cout << "frame.right.mX = " << frame.right.mX << endl
-            //     << "frame.right.mY = " << frame.right.mY << endl;
+    else if( mCollisionHandle != -1 )
+    {
+        gCollisionSystem.remove( mCollisionHandle );
+        mCollisionHandle = -1;
+    }
 
-            // Ajout de l'image dans l'animation.
-            animation.frames.push_back( frame );
+    /* Animation initiale de la machine à états (la première, par défaut);
+    le sprite pouvant être recrée, il garde sa poignée. */
+    if( mAnimationHandle == -1 )
+    {
+        mAnimationHandle = gAnimationSystem.add( mData );
+    }
 
-            // Noeud <frame> suivant.
-            frameNode = frameNode->NextSiblingElement();
-        }
+    else
+    {
+        gAnimationSystem.setData( mAnimationHandle, mData );
+    }
 
-        // Ajout de l'animation dans les animations du sprite.
-        mAnimations.push_back( animation );
+    gRegistry.getAnimations().add( mId, mAnimationHandle );
+    updateStateMachine();
 
-        // Noeud <animation> suivant.
-        animationNode = animationNode->NextSiblingElement();
-    }
+    // Première image, recopiée ensuite par gRegistry.updateRenderables().
+    getRenderable().src    = gAnimationSystem.getSrc( mAnimationHandle );
+    getRenderable().offset = gAnimationSystem.getOffset( mAnimationHandle );
 }
 
 //! @brief Procédure de test de collision d'un sprite.
+//!
+//! Test ponctuel entre deux sprites; les contacts de tous les corps sont
+//! calculés en bloc par gCollisionSystem.
 //! @param *sprite Pointeur vers l'élement à collisionner avec le sprite.
 //! @return Le résultat du test de collision.
 //!     false: le sprite ne collisionne pas.
 //!     true : le sprite collisionne.
 bool cirion::Sprite::collide( Sprite* sprite )
 {
-    if( !mCollidable ) { return false; }
+    if( !mCollidable || sprite == NULL || !sprite->mCollidable )
+    {
+        return false;
+    }
 
-    bool xCollide  = sprite->getPosition().mX >= sprite->getPosition().mX
-                                               + sprite->getHitbox().x
-                  && sprite->getPosition().mX <= sprite->getPosition().mX
-                                               + sprite->getHitbox().x 
-                                               + sprite->getHitbox().w;
+    float xMin      = getPosition().mX + mHitbox.x;
+    float yMin      = getPosition().mY + mHitbox.y;
+    float otherXMin = sprite->getPosition().mX + sprite->mHitbox.x;
+    float otherYMin = sprite->getPosition().mY + sprite->mHitbox.y;
 
-    bool yCollide  = sprite->getPosition().mY >= sprite->getPosition().mY
-                                               + sprite->getHitbox().y
-                  && sprite->getPosition().mY <= sprite->getPosition().mY
-                                               + sprite->getHitbox().y 
-                                               + sprite->getHitbox().h;
+    bool xCollide  = xMin < otherXMin + sprite->mHitbox.w
+                  && otherXMin < xMin + mHitbox.w;
 
-    return xCollide & yCollide;
+    bool yCollide  = yMin < otherYMin + sprite->mHitbox.h
+                  && otherYMin < yMin + mHitbox.h;
+
+    return xCollide && yCollide;
 }
 
 //! @brief Procédure de traîtement de l'évenement.
@@ -253,48 +182,19 @@ void cirion::Sprite::handleEvent( SDL_Event* event )
 }
 
 //! @brief Procédure de mise à jour du sprite.
-//! @param timeStep
-void cirion::Sprite::update( int timeStep )
+//!
+//! Les animations sont avancées en bloc par gAnimationSystem.update() et
+//! recopiées par gRegistry.updateRenderables(): il n'y a rien à faire.
+//! @param timeStep Inutilisé.
+void cirion::Sprite::update( float timeStep )
 {
-    if(    mAnimation->frames[mFrameIndex].duration != 0
-        && mEleapsed + timeStep >= mAnimation->frames[mFrameIndex].duration )
-    {
-        // Màj timer
-        mEleapsed = ( mEleapsed + timeStep ) 
-                    % mAnimation->frames[mFrameIndex].duration;
-
-        // Frame suivante
-        mFrameIndex = ( mFrameIndex == mAnimation->frames.size() -1 )
-                    ? 0
-                    : mFrameIndex + 1;
-    }
-
-    else
-    {
-        // Màj timer
-        mEleapsed += timeStep;
-    }
-
-    if( mAnimation != NULL )
-    {
-        // Si le sprite est orienté à droite
-        if( mFacingRight )
-        {
-            // Màj src pour le sprite orienté à droite
-            mSrc.x = mAnimation->frames[mFrameIndex].right.mX;
-            mSrc.y = mAnimation->frames[mFrameIndex].right.mY;
-        }
-
-        // Le sprite est orienté a gauche
-        else
-        {
-            // Màj src pour le sprite orienté à gauche
-            mSrc.x = mAnimation->frames[mFrameIndex].left.mX;
-            mSrc.y = mAnimation->frames[mFrameIndex].left.mY;
-        }
-    }
+}
 
-    //cout << mSrc.x << ", " << mSrc.y << endl;
+//! @brief Procédure de rattachement du sprite à son entité mère.
+//! @param parent L'identifiant de l'entité mère, ou OBJECT_NONE.
+void cirion::Sprite::setParent( ObjectId parent )
+{
+    gRegistry.getAttachments().get( mId ).parent = parent;
 }
 
 //! @brief Procédure de déf. de la position du sprite relative à l'entité mère.
@@ -302,32 +202,79 @@ void cirion::Sprite::update( int timeStep )
 //! @param yRelative Différence en ordonnée.
 void cirion::Sprite::setRelative( const Point2f& relative )
 {
-    mRelative = relative;
+    gRegistry.getAttachments().get( mId ).relative = relative;
 }
 
 //! @brief Procédure de définition de l'orientation du sprite.
 //! @param isFacingRight Indique si le sprite est orienté a droite.
 void cirion::Sprite::setFacingRight( bool facingRight )
 {
-    mFacingRight = facingRight;
+    if( mAnimationHandle != -1 )
+    {
+        gAnimationSystem.setFacingRight( mAnimationHandle, facingRight );
+    }
+}
+
+//! @brief Procédure de définition de l'animation utilisée par le sprite.
+//! @param id Identifiant de l'animation, résolu par getAnimationId().
+//! @throw CiException en cas d'échec.
+void cirion::Sprite::setAnimation( int id )
+{
+    if( mData == NULL || id < 0 || (size_t)id >= mData->animations.size() )
+    {
+        ostringstream oss;
+
+        oss << "Unable to set sprite animation #"
+            << id
+            << " : Not found.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    // Attribution de l'animation en cours
+    gAnimationSystem.setAnimation( mAnimationHandle, id );
 }
 
 //! @brief Procédure de définition de l'animation utilisée par le sprite.
 //! @param *name Nom de l'animation dans le vecteur d'animation du sprite.
-//! @return CiException en cas d'échec.
+//! @throw CiException en cas d'échec.
 void cirion::Sprite::setAnimation( const char* name )
+{
+    setAnimation( getAnimationId( name ) );
+}
+
+//! @brief Procédure de rattachement du sprite aux drapeaux d'état de son
+//!        entité, lus par updateStateMachines().
+//! @param flags Pointeur vers les drapeaux de l'entité mère, qui doit
+//!              survivre au sprite.
+void cirion::Sprite::setStateFlags( const Uint32* flags )
+{
+    mStateFlags = flags;
+    updateStateMachine();
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nom du sprite dans l'entité mère.
+const char* cirion::Sprite::getName()
+{
+    return mName.c_str();
+}
+
+//! @brief Fonction de résolution du nom d'une animation en identifiant.
+//!
+//! A appeler une fois au chargement: setAnimation( int ) est en O(1).
+//! @param *name Nom de l'animation.
+//! @return L'identifiant de l'animation.
+//! @throw CiException si l'animation n'existe pas.
+int cirion::Sprite::getAnimationId( const char* name )
 {
     // Parcours du vecteur d'animations du sprite
-    for( size_t i = 0; i != mAnimations.size(); i++ )
+    for( size_t i = 0; mData != NULL && i != mData->animations.size(); i++ )
     {
         // Comparaison avec le nom de l'animation cherchée
-        if( strcmp( mAnimations[i].name, name ) == 0 )
+        if( strcmp( mData->animations[i].name, name ) == 0 )
         {
-            // Attribution de l'animation en cours
-            mAnimation  = &mAnimations[i];
-            mFrameIndex = 0;
-            // On arrête tout
-            return;
+            return (int)i;
         }
     }
 
@@ -341,11 +288,29 @@ void cirion::Sprite::setAnimation( const char* name )
     throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
 }
 
+//! @brief Fonction accesseur.
+//! @return L'identifiant de l'animation en cours, ou -1.
+int cirion::Sprite::getAnimation()
+{
+    return mAnimationHandle != -1
+         ? gAnimationSystem.getAnimation( mAnimationHandle )
+         : -1;
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nom de l'animation en cours, ou NULL.
+const char* cirion::Sprite::getAnimationName()
+{
+    int id = getAnimation();
+
+    return id != -1 ? mData->animations[id].name : NULL;
+}
+
 //! @brief Fonction accesseur.
 //! @return La position du sprite relative à l'entité mère.
 Point2f cirion::Sprite::getRelative()
 {
-    return mRelative;
+    return gRegistry.getAttachments().get( mId ).relative;
 }
 
 //! @brief Fonction accesseur.
@@ -359,5 +324,53 @@ SDL_Rect cirion::Sprite::getHitbox()
 //! @return L'orientation du sprite.
 bool cirion::Sprite::isFacingRight()
 {
-    return mFacingRight;
+    return    mAnimationHandle != -1
+           && gAnimationSystem.isFacingRight( mAnimationHandle );
+}
+
+//! @brief Opérateur d'allocation, servi par gSpritePool.
+//! @param size La taille de l'objet.
+//! @return Pointeur vers l'emplacement.
+void* cirion::Sprite::operator new( size_t size )
+{
+    return gSpritePool.acquire( size );
+}
+
+//! @brief Opérateur de libération, vers gSpritePool.
+//! @param object Pointeur vers l'emplacement.
+//! @param size La taille de l'objet.
+void cirion::Sprite::operator delete( void* object, size_t size )
+{
+    gSpritePool.release( object, size );
+}
+
+//! @brief Fonction de calcul de la mémoire propre à l'instance, hors données
+//!        partagées.
+//! @return La taille en octets.
+size_t cirion::Sprite::getInstanceSize()
+{
+    return sizeof(Sprite) + mName.capacity()
+         + AnimationSystem::getSlotSize() + Registry::getSlotSize();
+}
+
+//! @brief Procédure d'inscription (ou de retrait) de la machine à états du
+//!        sprite dans gStateMachines: seuls les sprites d'une entité ayant
+//!        des transitions y figurent.
+void cirion::Sprite::updateStateMachine()
+{
+    StateMachine machine;
+
+    if(    mStateFlags == NULL
+        || mData       == NULL
+        || mData->transitions.empty() )
+    {
+        gStateMachines.remove( mId );
+        return;
+    }
+
+    machine.flags     = mStateFlags;
+    machine.data      = mData;
+    machine.animation = mAnimationHandle;
+
+    gStateMachines.add( mId, machine );
 }
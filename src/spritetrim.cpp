@@ -0,0 +1,226 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    spritetrim.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Rognage hors ligne des images de sprites.
+ */
+
+#include <sstream>
+#include <tinyxml2.h>
+#include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/log.hpp>
+#include <Cirion/spritetrim.hpp>
+#include <Cirion/surface.hpp>
+#include <Cirion/xmlerror.hpp>
+
+using namespace std;
+using namespace cirion;
+using namespace tinyxml2;
+
+//! @brief Fonction de calcul du rectangle opaque d'une cellule.
+//!
+//! Un pixel est transparent s'il est noir (couleur clé) ou d'alpha nul.
+//! @param surface La feuille de sprites, au format 32 bits.
+//! @param x Abscisse de la cellule.
+//! @param y Ordonnée de la cellule.
+//! @param w Largeur de la cellule.
+//! @param h Hauteur de la cellule.
+//! @return Le rectangle opaque, relatif à la cellule; vide si la cellule est
+//!         entièrement transparente.
+//! @throw CiException si la cellule déborde de la surface.
+SDL_Rect cirion::computeTrim( SDL_Surface* surface, int x, int y, int w, int h )
+{
+    SDL_Rect trim = { 0, 0, 0, 0 };
+    int      minX = w;
+    int      minY = h;
+    int      maxX = -1;
+    int      maxY = -1;
+    Uint8    r, g, b, a;
+
+    if(    x < 0 || y < 0
+        || x + w > surface->w
+        || y + h > surface->h )
+    {
+        ostringstream oss;
+
+        oss << "Unable to trim cell ("
+            << x << ", " << y << ", " << w << ", " << h
+            << "): out of the "
+            << surface->w << "x" << surface->h
+            << " spritesheet.";
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    SDL_LockSurface( surface );
+
+    for( int j = 0; j != h; j++ )
+    {
+        const Uint32* row = (const Uint32*)( (const Uint8*)surface->pixels
+                                             + ( y + j ) * surface->pitch );
+
+        for( int i = 0; i != w; i++ )
+        {
+            SDL_GetRGBA( row[x + i], surface->format, &r, &g, &b, &a );
+
+            if( a != 0x00 && ( r | g | b ) != 0x00 )
+            {
+                minX = i < minX ? i : minX;
+                minY = j < minY ? j : minY;
+                maxX = i > maxX ? i : maxX;
+                maxY = j > maxY ? j : maxY;
+            }
+        }
+    }
+
+    SDL_UnlockSurface( surface );
+
+    if( maxX != -1 )
+    {
+        trim.x = minX;
+        trim.y = minY;
+        trim.w = maxX - minX + 1;
+        trim.h = maxY - minY + 1;
+    }
+
+    return trim;
+}
+
+//! @brief Procédure de rognage des images d'une entité.
+//!
+//! Chaque fragment <left> / <right> reçoit les attributs trim_x, trim_y,
+//! trim_w et trim_h, puis le XML est réécrit. Le gain en pixels copiés par
+//! image est reporté au journal.
+//! @param entityName Nom de l'entité dans le répertoire des entités.
+//! @throw CiException en cas d'échec.
+void cirion::trimEntity( const char* entityName )
+{
+    ostringstream filepath;
+    ostringstream oss;
+    XMLDocument   xml;
+    XMLElement*   entityNode;
+    unsigned long cellArea    = 0; //!< Pixels copiés sans rognage.
+    unsigned long trimmedArea = 0; //!< Pixels copiés avec rognage.
+
+    filepath << gWorkingDir
+             << "/Entities/"
+             << entityName
+             << ".xml";
+
+    if( xml.LoadFile( filepath.str().c_str() ) != XML_NO_ERROR )
+    {
+        oss << "Unable to load the entity xml file \""
+            << filepath.str()
+            << "\": "
+            << getXmlErrorStr( xml.ErrorID() );
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    entityNode = xml.FirstChildElement( (const char*)"entity" );
+
+    if( entityNode == NULL )
+    {
+        throw CiException( "Unable to trim entity: Expected <entity> node.",
+            __PRETTY_FUNCTION__ );
+    }
+
+    // --- Parcours de tous les noeuds <sprite>. -------------------------------
+    for( XMLElement* spriteNode = entityNode->FirstChildElement( "sprite" );
+         spriteNode != NULL;
+         spriteNode = spriteNode->NextSiblingElement( "sprite" ) )
+    {
+        ostringstream texturepath;
+        Surface       surface;
+        int           w = spriteNode->IntAttribute( (const char*)"src_w" );
+        int           h = spriteNode->IntAttribute( (const char*)"src_h" );
+
+        texturepath << gWorkingDir
+                    << "/Textures/"
+                    << spriteNode->Attribute( (const char*)"spritesheet" )
+                    << ".bmp";
+
+        surface.create( texturepath.str().c_str() );
+
+        for( XMLElement* animationNode = spriteNode->FirstChildElement( "animation" );
+             animationNode != NULL;
+             animationNode = animationNode->NextSiblingElement( "animation" ) )
+        {
+            for( XMLElement* frameNode = animationNode->FirstChildElement( "frame" );
+                 frameNode != NULL;
+                 frameNode = frameNode->NextSiblingElement( "frame" ) )
+            {
+                const char* sides[] = { "left", "right" };
+
+                for( size_t i = 0; i != 2; i++ )
+                {
+                    XMLElement* node = frameNode->FirstChildElement( sides[i] );
+
+                    if( node == NULL )
+                    {
+                        continue;
+                    }
+
+                    SDL_Rect trim = computeTrim( surface.getSdl2Surface(),
+                                                 node->IntAttribute( "src_x" ),
+                                                 node->IntAttribute( "src_y" ),
+                                                 w,
+                                                 h );
+
+                    node->SetAttribute( "trim_x", trim.x );
+                    node->SetAttribute( "trim_y", trim.y );
+                    node->SetAttribute( "trim_w", trim.w );
+                    node->SetAttribute( "trim_h", trim.h );
+
+                    cellArea    += (unsigned long)( w * h );
+                    trimmedArea += (unsigned long)( trim.w * trim.h );
+                }
+            }
+        }
+    }
+
+    if( xml.SaveFile( filepath.str().c_str() ) != XML_NO_ERROR )
+    {
+        oss << "Unable to save the entity xml file \""
+            << filepath.str()
+            << "\": "
+            << getXmlErrorStr( xml.ErrorID() );
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    oss << "Entity \""
+        << entityName
+        << "\" trimmed: "
+        << trimmedArea
+        << " / "
+        << cellArea
+        << " px copied per frame set (overdraw -"
+        << ( cellArea != 0 ? 100 - trimmedArea * 100 / cellArea : 0 )
+        << "%).";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
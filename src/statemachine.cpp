@@ -0,0 +1,150 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    statemachine.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Machines à états des animations.
+ */
+
+#include <sstream>
+#include <string>
+#include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/statemachine.hpp>
+
+using namespace std;
+using namespace cirion;
+
+/**
+ * Une structure pour associer un drapeau d'état à son nom dans le XML.
+ */
+typedef struct
+{
+    const char* name;
+    Uint32 flag;
+} StateFlagName;
+
+//! La table des noms de drapeaux.
+static const StateFlagName gStateFlagNames[] =
+{
+    { "moving"  , STATE_MOVING   },
+    { "velocity", STATE_VELOCITY },
+    { "airborne", STATE_AIRBORNE }
+};
+
+//! @brief Fonction de lecture d'une liste de drapeaux, séparés par des '|'.
+//! @param flags La liste, par exemple "moving|airborne", ou NULL.
+//! @return Le masque des drapeaux.
+//! @throw CiException si un drapeau est inconnu.
+Uint32 cirion::parseStateFlags( const char* flags )
+{
+    Uint32 mask = 0;
+    string list;
+    size_t start = 0;
+
+    if( flags == NULL )
+    {
+        return 0;
+    }
+
+    list = flags;
+
+    while( start <= list.size() )
+    {
+        size_t end  = list.find( '|', start );
+        string name = list.substr( start,
+                      end == string::npos ? string::npos : end - start );
+        bool   found = false;
+
+        for( size_t i = 0;
+             i != sizeof(gStateFlagNames) / sizeof(StateFlagName);
+             i++ )
+        {
+            if( name == gStateFlagNames[i].name )
+            {
+                mask |= gStateFlagNames[i].flag;
+                found = true;
+                break;
+            }
+        }
+
+        if( !found && !name.empty() )
+        {
+            ostringstream oss;
+
+            oss << "Unknown state flag \""
+                << name
+                << "\".";
+
+            throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+        }
+
+        if( end == string::npos )
+        {
+            break;
+        }
+
+        start = end + 1;
+    }
+
+    return mask;
+}
+
+//! @brief Procédure d'évaluation de toutes les machines à états, d'un seul
+//!        balayage du tableau compact gStateMachines.
+//!
+//! Appelée une fois par mise à jour, après les objets: les entités n'ont
+//! qu'à positionner leurs drapeaux pendant leur propre mise à jour. Pour
+//! chaque sprite, la première transition valide est prise; l'animation
+//! n'est relancée que si elle change.
+void cirion::updateStateMachines()
+{
+    for( size_t i = 0; i != gStateMachines.getCount(); i++ )
+    {
+        const StateMachine&            machine     = gStateMachines.at( i );
+        const std::vector<Transition>& transitions = machine.data->transitions;
+        Uint32                         flags       = *machine.flags;
+        int                            animationId;
+
+        animationId = gAnimationSystem.getAnimation( machine.animation );
+
+        for( size_t j = 0; j != transitions.size(); j++ )
+        {
+            const Transition& transition = transitions[j];
+
+            if(    ( transition.from == -1 || transition.from == animationId )
+                && ( flags & transition.require ) == transition.require
+                && ( flags & transition.forbid  ) == 0 )
+            {
+                if( transition.to != animationId )
+                {
+                    gAnimationSystem.setAnimation( machine.animation,
+                                                   transition.to );
+                }
+
+                break;
+            }
+        }
+    }
+}
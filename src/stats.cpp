@@ -0,0 +1,139 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file    stats.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Compteurs de performance du moteur.
+ */
+
+#include <cstring>
+#include <sstream>
+#include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/log.hpp>
+#include <Cirion/stats.hpp>
+
+using namespace std;
+using namespace cirion;
+
+//! @brief Procédure de remise à zéro des compteurs.
+void cirion::resetStats()
+{
+    memset( &gStats, 0x00, sizeof(Stats) );
+}
+
+//! @brief Procédure de report des compteurs au journal.
+void cirion::logStats()
+{
+    ostringstream oss;
+    Uint64        elapsed = gFramePacer.getElapsedTime();
+
+    oss << "Texture cache\t: "
+        << gStats.textureCacheHits
+        << " hit(s), "
+        << gStats.textureCacheMisses
+        << " miss(es)"
+        << endl
+
+        << "Texture memory\t: "
+        << gStats.textureMemory / 1024
+        << " KiB, "
+        << gStats.textureEvictions
+        << " eviction(s), "
+        << gStats.textureReloads
+        << " reload(s)"
+        << endl
+
+        << "Entity cache\t: "
+        << gStats.entityCacheHits
+        << " hit(s), "
+        << gStats.entityCacheMisses
+        << " miss(es)"
+        << endl
+
+        << "Pixel pool\t: "
+        << gStats.pixelPoolHits
+        << " hit(s), "
+        << gStats.pixelPoolMisses
+        << " miss(es), "
+        << gPixelPool.getReservedSize() / 1024
+        << " KiB reserved"
+        << endl
+
+        << "Object pool\t: "
+        << gStats.objectPoolHits
+        << " hit(s), "
+        << gStats.objectPoolMisses
+        << " miss(es), "
+        << gSpritePool.getLiveCount()
+        << " live, "
+        << gSpritePool.getReservedSize() / 1024
+        << " KiB reserved"
+        << endl
+
+        << "Level arena\t: "
+        << gWorld.getArena().getUsedSize() / 1024
+        << " KiB used, "
+        << gWorld.getArena().getReservedSize() / 1024
+        << " KiB reserved, "
+        << gStats.arenaChunks
+        << " chunk(s) allocated"
+        << endl
+
+        << "Simulation\t: "
+        << gStats.simulationTicks
+        << " tick(s), "
+        << gStats.simulationDropped
+        << " ms dropped"
+        << endl
+
+        << "Rendering\t: "
+        << gStats.drawCalls
+        << " draw call(s), "
+        << gStats.textureSwitches
+        << " texture switch(es) over "
+        << gFrame
+        << " frame(s)"
+        << endl
+
+        << "Events\t\t: "
+        << gStats.eventsDispatched
+        << " event(s), "
+        << gStats.eventDeliveries
+        << " delivery(ies)"
+        << endl
+
+        << "Frame pacing\t: "
+        << gFramePacer.getTargetRate()
+        << " fps target, "
+        << ( elapsed != 0 ? 100 - gFramePacer.getSleepTime() * 100 / elapsed : 100 )
+        << " % awake, "
+        << gFramePacer.getSpinTime() / 1000000
+        << " ms spun, "
+        << gFramePacer.getIdleCount()
+        << " idle wait(s), "
+        << gFramePacer.getOvershoot() / 1000
+        << " us sleep overshoot";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
@@ -26,11 +26,13 @@
  * @brief   Manipulation des surfaces.
  */
 
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <Cirion/ciexception.hpp>
 #include <Cirion/cirion.hpp>
 #include <Cirion/log.hpp>
+#include <Cirion/pixelpool.hpp>
 #include <Cirion/surface.hpp> // R_MASK, G_MASK, B_MASK, A_MASK
 
 using namespace std;
@@ -42,7 +44,9 @@ using namespace std;
 //! @brief Constructeur pour la classe Surface.
 cirion::Surface::Surface()
 {
-    mSurface = NULL;
+    mSurface    = NULL;
+    mPixels     = NULL;
+    mPixelsSize = 0;
 }
 
 //! @brief Déstructeur pour la classe Surface.
@@ -50,9 +54,8 @@ cirion::Surface::~Surface()
 {
     if( mSurface != NULL )
     {
-        SDL_FreeSurface( mSurface );
+        release();
         log( (char*)"Surface freed.", __PRETTY_FUNCTION__ );
-        mSurface = NULL;
     }
 }
 
@@ -70,6 +73,8 @@ void cirion::Surface::create( int width, int height )
     ostringstream oss;
     //! La nouvelle surface crée.
     SDL_Surface*  surface = NULL;
+    //! La taille des pixels, en octets.
+    size_t        size    = (size_t)width * (size_t)height * 4;
 
     // --- SDL2 est-elle initialisée ? -----------------------------------------
     if ( !(SDL_WasInit(0) & SDL_INIT_VIDEO) )
@@ -81,17 +86,29 @@ void cirion::Surface::create( int width, int height )
     }
 
     // --- Libération de l'ancienne surface, si elle existe. -------------------
-    if( mSurface != NULL )
+    release();
+
+    // --- Création d'une nouvelle surface sur un tampon de la réserve. --------
+    mPixels = gPixelPool.acquire( size );
+
+    if( mPixels == NULL )
     {
-        SDL_FreeSurface( mSurface );
+        throw CiException( "Surface creation failed: out of memory.",
+            __PRETTY_FUNCTION__ );
     }
 
-    // --- Création d'une nouvelle surface. ------------------------------------
-    surface = SDL_CreateRGBSurface( 0, width, height, 32, R_MASK, G_MASK,
-        B_MASK, A_MASK );
+    mPixelsSize = size;
+
+    // Un tampon recyclé n'est pas vierge, contrairement à SDL_CreateRGBSurface.
+    memset( mPixels, 0x00, size );
+
+    surface = SDL_CreateRGBSurfaceFrom( mPixels, width, height, 32, width * 4,
+        R_MASK, G_MASK, B_MASK, A_MASK );
 
     if ( surface == NULL )
     {
+        release();
+
         oss << "Surface creation failed: "
             << SDL_GetError();
 
@@ -125,10 +142,10 @@ void cirion::Surface::create( const char* filepath )
     ostringstream oss;
     //! La surface crée à partir du fichier.
     SDL_Surface*  surface           = NULL;
-    //! Le format des pixels de la surface convertie.
-    Uint32        pixelFormat;
     //! La surface optimisée pour le format d'affichage courrant.
     SDL_Surface*  optimized_surface = NULL;
+    //! La taille des pixels de la surface optimisée, en octets.
+    size_t        size;
 
     // --- SDL2 est-elle initialisée ? -----------------------------------------
     if ( !(SDL_WasInit(0) & SDL_INIT_VIDEO) )
@@ -140,10 +157,7 @@ void cirion::Surface::create( const char* filepath )
     }
 
     // --- Libération de l'ancienne surface, si elle existe. -------------------
-    if( mSurface != NULL )
-    {
-        SDL_FreeSurface( mSurface );
-    }
+    release();
 
     // --- Création d'une surface à partir d'un bitmap. ------------------------
     surface = SDL_LoadBMP( filepath );
@@ -156,20 +170,47 @@ void cirion::Surface::create( const char* filepath )
         throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
     }
 
-    // --- Création d'une surface optimisée. -----------------------------------
-    pixelFormat = SDL_MasksToPixelFormatEnum( 32, R_MASK, G_MASK, B_MASK,
-        A_MASK );
+    // --- Création d'une surface optimisée sur un tampon de la réserve. -------
 
-    optimized_surface = SDL_ConvertSurfaceFormat( surface, pixelFormat, 0 );
+    /* Equivalent à SDL_ConvertSurfaceFormat(), sans allouer de nouveaux
+    pixels: la conversion est une copie sans mélange vers le tampon. */
+    size    = (size_t)surface->w * (size_t)surface->h * 4;
+    mPixels = gPixelPool.acquire( size );
 
-    if( optimized_surface == NULL )
+    if( mPixels == NULL )
+    {
+        SDL_FreeSurface( surface );
+
+        throw CiException( "Surface optimization failed: out of memory.",
+            __PRETTY_FUNCTION__ );
+    }
+
+    mPixelsSize = size;
+
+    optimized_surface = SDL_CreateRGBSurfaceFrom( mPixels, surface->w,
+        surface->h, 32, surface->w * 4, R_MASK, G_MASK, B_MASK, A_MASK );
+
+    if(    optimized_surface == NULL
+        || SDL_SetSurfaceBlendMode( surface, SDL_BLENDMODE_NONE ) != 0
+        || SDL_BlitSurface( surface, NULL, optimized_surface, NULL ) != 0 )
     {
         oss << "Surface optimization failed: "
             << SDL_GetError();
 
+        if( optimized_surface != NULL )
+        {
+            SDL_FreeSurface( optimized_surface );
+        }
+
+        SDL_FreeSurface( surface );
+        release();
+
         throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
     }
 
+    // Le bitmap brut n'est plus utile une fois converti.
+    SDL_FreeSurface( surface );
+
     oss << "New "
         #ifdef DEBUG
         << optimized_surface->w
@@ -191,6 +232,24 @@ void cirion::Surface::create( const char* filepath )
     mSurface = optimized_surface;
 }
 
+//! @brief Procédure de libération de la surface et de rendu de ses pixels à
+//!        la réserve.
+void cirion::Surface::release()
+{
+    if( mSurface != NULL )
+    {
+        SDL_FreeSurface( mSurface );
+        mSurface = NULL;
+    }
+
+    if( mPixels != NULL )
+    {
+        gPixelPool.release( mPixels, mPixelsSize );
+        mPixels     = NULL;
+        mPixelsSize = 0;
+    }
+}
+
 //! @brief Procédure de définition du mode de simulation de la transparence.
 //! @param mode Le mode de simulation de la transparence.
 //! @throw CiException en cas d'échec.
@@ -0,0 +1,256 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    textbatch.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Rendu groupé de texte en police bitmap.
+ */
+
+#include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/textbatch.hpp>
+#include <Cirion/texture.hpp>
+
+using namespace std;
+using namespace cirion;
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe TextBatch.
+cirion::TextBatch::TextBatch():
+    mTexture ( NULL ),
+    mCount   ( 0 ),
+    mCapacity( 0 )
+{
+}
+
+//! @brief Déstructeur pour la classe TextBatch. La texture appartient à la
+//!        liste des textures.
+cirion::TextBatch::~TextBatch()
+{
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de création.
+//! @param charset Le nom de la texture de la police.
+//! @param capacity Le nombre maximum de caractères et rectangles par lot.
+//! @throw CiException en cas d'échec.
+void cirion::TextBatch::create( const char* charset, size_t capacity )
+{
+    mTexture  = getTexture( charset );
+    mCapacity = capacity;
+    mCount    = 0;
+
+    #ifdef TEXT_GEOMETRY
+
+    mVertices.assign( capacity * 4, SDL_Vertex() );
+    mIndices.clear();
+    mIndices.reserve( capacity * 6 );
+
+    for( size_t i = 0; i != capacity; i++ )
+    {
+        int first = (int)( i * 4 );
+
+        mIndices.push_back( first );
+        mIndices.push_back( first + 1 );
+        mIndices.push_back( first + 2 );
+        mIndices.push_back( first + 2 );
+        mIndices.push_back( first + 1 );
+        mIndices.push_back( first + 3 );
+    }
+
+    #else
+
+    mQuads.assign( capacity, TextQuad() );
+
+    #endif // TEXT_GEOMETRY
+}
+
+//! @brief Procédure de vidage du lot, avant la composition d'une image.
+void cirion::TextBatch::clear()
+{
+    mCount = 0;
+}
+
+//! @brief Fonction d'ajout d'un texte au lot. Un retour à la ligne revient
+//!        sous le premier caractère.
+//! @param x Abscisse du premier caractère.
+//! @param y Ordonnée du premier caractère.
+//! @param text Le texte, en ASCII.
+//! @param color La couleur du texte, qui module aussi son fond.
+//! @return L'abscisse après le dernier caractère.
+int cirion::TextBatch::print( int x, int y, const char* text,
+                              const SDL_Color& color )
+{
+    SDL_Rect src;
+    SDL_Rect dest;
+
+    src.w  = TEXT_GLYPH_WIDTH;
+    src.h  = TEXT_GLYPH_HEIGHT;
+    dest.x = x;
+    dest.y = y;
+    dest.w = TEXT_GLYPH_WIDTH;
+    dest.h = TEXT_GLYPH_HEIGHT;
+
+    for( const unsigned char* c = (const unsigned char*)text; *c != '\0'; c++ )
+    {
+        if( *c == '\n' )
+        {
+            dest.x  = x;
+            dest.y += TEXT_GLYPH_HEIGHT;
+            continue;
+        }
+
+        src.x   = ( *c % 16 ) * TEXT_GLYPH_WIDTH;
+        src.y   = ( *c / 16 ) * TEXT_GLYPH_HEIGHT;
+        push( src, dest, color );
+        dest.x += TEXT_GLYPH_WIDTH;
+    }
+
+    return dest.x;
+}
+
+//! @brief Procédure d'ajout d'un rectangle uni au lot: il est étiré depuis
+//!        un texel plein de la police.
+//! @param rect Le rectangle.
+//! @param color Sa couleur.
+void cirion::TextBatch::fill( const SDL_Rect& rect, const SDL_Color& color )
+{
+    SDL_Rect src;
+
+    src.x = TEXT_SOLID_X;
+    src.y = TEXT_SOLID_Y;
+    src.w = 0;
+    src.h = 0;
+
+    push( src, rect, color );
+}
+
+//! @brief Procédure de dessin du lot, en un appel avec SDL_RenderGeometry().
+//! @throw CiException en cas d'échec.
+void cirion::TextBatch::draw()
+{
+    if( mCount == 0 || mTexture == NULL )
+    {
+        return;
+    }
+
+    #ifdef TEXT_GEOMETRY
+
+    renderGeometry( mTexture->bind(),
+                    &mVertices[0],
+                    (int)( mCount * 4 ),
+                    &mIndices[0],
+                    (int)( mCount * 6 ) );
+
+    #else
+
+    // Sans SDL_RenderGeometry(), une copie par quadrilatère.
+    SDL_Texture* texture = mTexture->bind();
+
+    for( size_t i = 0; i != mCount; i++ )
+    {
+        const TextQuad& quad = mQuads[i];
+        SDL_Rect        src  = quad.src;
+
+        // Un texel pour les rectangles unis.
+        src.w = src.w != 0 ? src.w : 1;
+        src.h = src.h != 0 ? src.h : 1;
+
+        mTexture->setRgbMod( quad.color.r, quad.color.g, quad.color.b );
+        mTexture->setAlphaMod( quad.color.a );
+        renderCopy( texture, &src, &quad.dest );
+    }
+
+    mTexture->setRgbMod( 0xFF, 0xFF, 0xFF );
+    mTexture->setAlphaMod( 0xFF );
+
+    #endif // TEXT_GEOMETRY
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre de quadrilatères composés.
+size_t cirion::TextBatch::getCount()
+{
+    return mCount;
+}
+
+//! @brief Fonction accesseur.
+//! @return Le nombre maximum de quadrilatères.
+size_t cirion::TextBatch::getCapacity()
+{
+    return mCapacity;
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées.                                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure d'ajout d'un quadrilatère, ignoré si le lot est plein.
+//! @param src Le rectangle source dans la police; vide, le centre d'un texel.
+//! @param dest Le rectangle destination.
+//! @param color La couleur.
+void cirion::TextBatch::push( const SDL_Rect& src,
+                              const SDL_Rect& dest,
+                              const SDL_Color& color )
+{
+    if( mCount == mCapacity )
+    {
+        return;
+    }
+
+    #ifdef TEXT_GEOMETRY
+
+    SDL_Vertex* vertex = &mVertices[ mCount * 4 ];
+    float       width  = (float)mTexture->getWidth();
+    float       height = (float)mTexture->getHeight();
+    float       u0     = src.w != 0 ? src.x / width  : ( src.x + 0.5f ) / width;
+    float       v0     = src.h != 0 ? src.y / height : ( src.y + 0.5f ) / height;
+    float       u1     = src.w != 0 ? ( src.x + src.w ) / width  : u0;
+    float       v1     = src.h != 0 ? ( src.y + src.h ) / height : v0;
+
+    for( int i = 0; i != 4; i++ )
+    {
+        vertex[i].color       = color;
+        vertex[i].position.x  = (float)( i % 2 == 0 ? dest.x : dest.x + dest.w );
+        vertex[i].position.y  = (float)( i < 2      ? dest.y : dest.y + dest.h );
+        vertex[i].tex_coord.x = i % 2 == 0 ? u0 : u1;
+        vertex[i].tex_coord.y = i < 2      ? v0 : v1;
+    }
+
+    #else
+
+    mQuads[mCount].src   = src;
+    mQuads[mCount].dest  = dest;
+    mQuads[mCount].color = color;
+
+    #endif // TEXT_GEOMETRY
+
+    mCount++;
+}
@@ -20,28 +20,28 @@
 
 /**
  * @file    texture.cpp
- * @version 0.5
+ * @version 0.6
  * @author  Jérémy S. "Qwoak" <qwoak11 at gmail dot com>
- * @date    27 Novembre 2015
+ * @date    18 Octobre 2026
  * @brief   Manipulation des textures.
  */
 
+#include <algorithm> // swap()
 #include <iostream>
 #include <sstream>
 #include <vector>
 #include <cstring> // memcpy()
 #include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/cookedtexture.hpp>
 #include <Cirion/log.hpp>
+#include <Cirion/stats.hpp>
 #include <Cirion/surface.hpp>
 #include <Cirion/texture.hpp>
 
 using namespace std;
 using namespace cirion;
 
-extern char*         gWorkingDir; //!< cf cirion.cpp
-extern SDL_Window*   gWindow;     //!< cf cirion.cpp
-extern SDL_Renderer* gRenderer;   //!< cf cirion.cpp
-
 /* +------------------------------------------------------------------------+
    ! Définition des constructeurs / déstructeurs.                           !
    +------------------------------------------------------------------------+ */
@@ -51,7 +51,12 @@ cirion::Texture::Texture():
     mName   (NULL),
     mTexture(NULL),
     mPixels (NULL),
-    mPitch  (0)
+    mPitch  (0),
+    mSourceHash(0),
+    mWidth  (0),
+    mHeight (0),
+    mLastUsedFrame(0),
+    mIsEvicted(false)
 {
 }
 
@@ -71,6 +76,8 @@ cirion::Texture::~Texture()
         log( oss.str().c_str(), __PRETTY_FUNCTION__ );
         mTexture = NULL;
     }
+
+    delete[] mName;
 }
 
 /* +------------------------------------------------------------------------+
@@ -115,6 +122,10 @@ void cirion::Texture::create( Surface* surface )
         throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
     }
 
+    mWidth     = surface->getSdl2Surface()->w;
+    mHeight    = surface->getSdl2Surface()->h;
+    mIsEvicted = false;
+
     // --- Verouillage de la texture pour manipulations. -----------------------
     try
     { 
@@ -179,24 +190,100 @@ void cirion::Texture::create( Surface* surface )
     log( (char*)"New texture created from surface.", __PRETTY_FUNCTION__ );
 }
 
+//! @brief Procédure de création d'une texture depuis une texture précuite.
+//! @param *cooked La texture précuite source.
+//! @throw CiException en cas d'échec.
+void cirion::Texture::create( CookedTexture* cooked )
+{
+    // --- SDL2 est-elle initialisée ? -----------------------------------------
+    if ( !(SDL_WasInit(0) & SDL_INIT_VIDEO) )
+    {
+        throw CiException(
+            "Texture creation failed: SDL2 video was not initialized.",
+            __PRETTY_FUNCTION__
+        );
+    }
+
+    // --- Destruction de l'ancienne texture, si elle existe. ------------------
+    if( mTexture != NULL )
+    {
+        SDL_DestroyTexture( mTexture );
+        mTexture = NULL;
+    }
+
+    // --- Création d'une texture streamable. ----------------------------------
+    mTexture = SDL_CreateTexture( gRenderer,
+                                  cooked->getFormat(),
+                                  SDL_TEXTUREACCESS_STREAMING,
+                                  cooked->getWidth(),
+                                  cooked->getHeight() );
+
+    if( mTexture == NULL )
+    {
+        ostringstream oss;
+
+        oss << "Texture creation from cooked texture failed: "
+            << SDL_GetError();
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+
+    mWidth     = cooked->getWidth();
+    mHeight    = cooked->getHeight();
+    mIsEvicted = false;
+
+    // --- Copie des pixels précuits dans la texture. --------------------------
+
+    /* La couleur clé est déjà appliquée: il n'y a plus qu'à copier les rangées,
+    le pitch de la texture vérouillée pouvant différer de celui du fichier. */
+    lock();
+
+    const Uint8* src = (const Uint8*)cooked->getPixels();
+    Uint8*       dst = (Uint8*)mPixels;
+    size_t       row = (size_t)cooked->getWidth() * 4;
+
+    for( int y = 0; y != cooked->getHeight(); y++ )
+    {
+        memcpy( dst + y * mPitch, src + y * cooked->getPitch(), row );
+    }
+
+    // --- Déverouillage de la texture. ----------------------------------------
+    unlock();
+    setBlendMode( SDL_BLENDMODE_BLEND );
+
+    mSourceHash = cooked->getSourceHash();
+}
+
 //! @brief Procédure de création d'une texture.
 //! @param Le nom de la texture dans le répertoire des textures.
 //! @throw CiException en cas d'échec.
 void cirion::Texture::create( const char* name )
 {
-    ostringstream filepath; //!< Le chemin du bitmap.
-    Surface       surface;  //!< La surface chargée avec le bitmap.
+    CIRION_PROFILE_ZONE( "Texture::create" );
+
+    ostringstream filepath;  //!< Le chemin du bitmap.
+    ostringstream cachepath; //!< Le chemin de la texture précuite.
+    ostringstream oss;       //!< Un flux de chaîne pour le journal.
+    CookedTexture cooked;    //!< La texture précuite.
+    Uint32        hash;      //!< L'empreinte du bitmap.
+    bool          isCached;  //!< Indique si le cache est à jour.
+    Uint64        start = SDL_GetPerformanceCounter();
 
-    // --- Construction du chemin du bitmap. -----------------------------------
+    // --- Construction des chemins du bitmap et de la texture précuite. -------
     filepath << gWorkingDir
              << "/Textures/"
              << name
              << ".bmp";
 
-    // --- Création de la surface à partir du bitmap. --------------------------
+    cachepath << gWorkingDir
+              << "/Cache/"
+              << name
+              << ".ctx";
+
+    // --- Le cache est-il à jour ? --------------------------------------------
     try
     {
-        surface.create( filepath.str().c_str() );
+        hash = CookedTexture::computeSourceHash( filepath.str().c_str() );
     }
 
     catch( CiException const& e )
@@ -207,19 +294,169 @@ void cirion::Texture::create( const char* name )
             __PRETTY_FUNCTION__ );
     }
 
-    // --- Création de la texture à partir de la surface. ----------------------
-    try
+    isCached = false;
+
+    if( gConfig.mIsTextureCacheEnabled )
     {
-        create( &surface );
+        try
+        {
+            cooked.load( cachepath.str().c_str() );
+            isCached = cooked.getSourceHash() == hash;
+        }
+
+        catch( CiException const& e )
+        {
+            isCached = false;
+        }
     }
 
-    catch( CiException const& e )
+    // --- Sinon, (re)cuisson depuis le bitmap. --------------------------------
+    if( !isCached )
+    {
+        Surface surface; //!< La surface chargée avec le bitmap.
+
+        try
+        {
+            surface.create( filepath.str().c_str() );
+            cooked.cook( &surface, hash );
+        }
+
+        catch( CiException const& e )
+        {
+            log( e );
+
+            throw CiException( "Unable to process texture creation.",
+                __PRETTY_FUNCTION__ );
+        }
+
+        /* Un cache impossible à écrire (support en lecture seule, ...) ne doit
+        pas empêcher la création de la texture. */
+        if( gConfig.mIsTextureCacheEnabled )
+        {
+            try
+            {
+                cooked.write( cachepath.str().c_str() );
+            }
+
+            catch( CiException const& e )
+            {
+                log( e );
+            }
+        }
+
+        gStats.textureCacheMisses++;
+    }
+
+    else
     {
-        throw e;
+        gStats.textureCacheHits++;
     }
 
+    // --- Création de la texture à partir des pixels précuits. ----------------
+    create( &cooked );
+
     // --- Définition du nom de la texture. ------------------------------------
     setName( name );
+
+    oss << "Texture \""
+        << name
+        << "\" created from "
+        << ( isCached ? "cooked cache" : "bitmap (cooked)" )
+        << " in "
+        << ( SDL_GetPerformanceCounter() - start ) * 1000000
+         / SDL_GetPerformanceFrequency()
+        << " us.";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+}
+
+//! @brief Procédure d'envoi d'un rectangle de pixels précuits.
+//!
+//! Utilisée par gAssetWatcher pour ne renvoyer que les pixels modifiés d'un
+//! bitmap, par bandes. L'empreinte de la texture n'est pas modifiée: voir
+//! setSourceHash().
+//! @param cooked Les pixels, aux dimensions de la texture.
+//! @param rect Le rectangle à envoyer.
+//! @throw CiException en cas d'échec.
+void cirion::Texture::update( CookedTexture* cooked, const SDL_Rect& rect )
+{
+    CIRION_PROFILE_ZONE( "Texture::update" );
+
+    const Uint8* pixels = (const Uint8*)cooked->getPixels();
+
+    if( mTexture == NULL || rect.w <= 0 || rect.h <= 0 )
+    {
+        return;
+    }
+
+    if( SDL_UpdateTexture( mTexture,
+                           &rect,
+                           pixels + rect.y * cooked->getPitch() + rect.x * 4,
+                           cooked->getPitch() ) != 0 )
+    {
+        ostringstream oss;
+
+        oss << "Unable to update texture \""
+            << ( mName != NULL ? mName : "" )
+            << "\": "
+            << SDL_GetError();
+
+        throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+    }
+}
+
+//! @brief Procédure d'éviction de la texture de la mémoire vidéo.
+//!
+//! Seuls le nom et les dimensions sont conservés: la texture sera recrée
+//! depuis le cache (ou le bitmap) lors de sa prochaine utilisation.
+void cirion::Texture::evict()
+{
+    if( mName == NULL || mTexture == NULL )
+    {
+        return;
+    }
+
+    if( mPixels != NULL )
+    {
+        unlock();
+    }
+
+    SDL_DestroyTexture( mTexture );
+    mTexture   = NULL;
+    mIsEvicted = true;
+    gStats.textureEvictions++;
+}
+
+//! @brief Procédure d'échange de deux textures, pour remplacer une texture
+//!        par une autre chargée à part.
+//! @param texture La texture à échanger.
+void cirion::Texture::swap( Texture& texture )
+{
+    std::swap( mName         , texture.mName          );
+    std::swap( mTexture      , texture.mTexture       );
+    std::swap( mPixels       , texture.mPixels        );
+    std::swap( mPitch        , texture.mPitch         );
+    std::swap( mSourceHash   , texture.mSourceHash    );
+    std::swap( mWidth        , texture.mWidth         );
+    std::swap( mHeight       , texture.mHeight        );
+    std::swap( mLastUsedFrame, texture.mLastUsedFrame );
+    std::swap( mIsEvicted    , texture.mIsEvicted     );
+}
+
+//! @brief Fonction de préparation de la texture pour le dessin: elle est
+//!        recrée si elle a été évincée et marquée comme utilisée.
+//! @return Pointeur vers une structure de texture définie par SDL2.
+//! @throw CiException en cas d'échec.
+SDL_Texture* cirion::Texture::bind()
+{
+    if( mIsEvicted )
+    {
+        create( mName );
+        gStats.textureReloads++;
+    }
+
+    mLastUsedFrame = gFrame;
+    return mTexture;
 }
 
 //! @brief Procédure de vérouillage de la texture pour l'accès en écriture.
@@ -326,6 +563,15 @@ void cirion::Texture::setRgbMod( Uint8 red, Uint8 green, Uint8 blue )
     }
 }
 
+//! @brief Procédure de définition de l'empreinte du bitmap source.
+//!
+//! Appelée une fois tous les rectangles modifiés envoyés par update().
+//! @param hash L'empreinte du bitmap dont les pixels sont dans la texture.
+void cirion::Texture::setSourceHash( Uint32 hash )
+{
+    mSourceHash = hash;
+}
+
 //! @brief Fonction accesseur.
 //! @return Le nom de la texture.
 const char* cirion::Texture::getName()
@@ -344,20 +590,14 @@ SDL_Texture* cirion::Texture::getSdl2Texture()
 //! @return La largeur de la texture, en pixels.
 int cirion::Texture::getWidth()
 {
-    int width; //!< La largeur récupérée depuis la structure de texture.
-    
-    SDL_QueryTexture( mTexture, NULL, NULL, &width, NULL );
-    return width;
+    return mWidth;
 }
 
 //! @brief Fonction accesseur.
 //! @return La hauteur de la texture, en pixels.
 int cirion::Texture::getHeight()
 {
-    int height; //!< La hauteur récupérée depuis la structure de texture.
-    
-    SDL_QueryTexture( mTexture, NULL, NULL, NULL, &height );
-    return height;
+    return mHeight;
 }
 
 //! @brief Fonction accesseur.
@@ -374,6 +614,34 @@ int cirion::Texture::getPitch()
     return mPitch;
 }
 
+//! @brief Fonction accesseur.
+//! @return La mémoire occupée par la texture résidente, en octets.
+size_t cirion::Texture::getMemorySize()
+{
+    return mTexture == NULL ? 0 : (size_t)mWidth * (size_t)mHeight * 4;
+}
+
+//! @brief Fonction accesseur.
+//! @return L'empreinte du bitmap source des pixels.
+Uint32 cirion::Texture::getSourceHash()
+{
+    return mSourceHash;
+}
+
+//! @brief Fonction accesseur.
+//! @return Le numéro de la dernière image où la texture a été utilisée.
+Uint32 cirion::Texture::getLastUsedFrame()
+{
+    return mLastUsedFrame;
+}
+
+//! @brief Fonction accesseur.
+//! @return Vrai si la texture a été évincée de la mémoire vidéo.
+bool cirion::Texture::isEvicted()
+{
+    return mIsEvicted;
+}
+
 /* +------------------------------------------------------------------------+
    ! Définitions des méthodes privées.                                      !
    +------------------------------------------------------------------------+ */
@@ -382,5 +650,56 @@ int cirion::Texture::getPitch()
 //! @param name Le nouveau nom de la texture.
 void cirion::Texture::setName( const char* name )
 {
-    mName = (char*)name;
+    /* Le nom est copié: il doit survivre à la source (document XML d'une
+    entité, ...) pour pouvoir recréer la texture après une éviction. */
+    if( name == mName )
+    {
+        return;
+    }
+
+    delete[] mName;
+    mName = new char[ strlen( name ) + 1 ];
+    strcpy( mName, name );
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des fonctions du registre.                                 !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Fonction d'obtention d'une texture partagée, créée au premier appel.
+//! @param name Le nom de la texture dans le répertoire des textures.
+//! @return Pointeur vers la texture.
+//! @throw CiException en cas d'échec.
+Texture* cirion::getTexture( const char* name )
+{
+    Texture* texture;
+
+    for( size_t i = 0; i != gTextures.size(); i++ )
+    {
+        if(    gTextures[i]->getName() != NULL
+            && strcmp( gTextures[i]->getName(), name ) == 0 )
+        {
+            return gTextures[i];
+        }
+    }
+
+    texture = new Texture();
+
+    try
+    {
+        texture->create( name );
+    }
+
+    catch( CiException const& e )
+    {
+        log( e );
+        delete texture;
+
+        throw CiException( "Unable to create the requested texture.",
+            __PRETTY_FUNCTION__ );
+    }
+
+    gTextures.push_back( texture );
+
+    return texture;
 }
@@ -0,0 +1,612 @@
+/*
+ * This file is part of Cirion.
+ *
+ * Cirion, a side-scrolling game engine built over SDL2 and TinyXML2.
+ * Copyright (C) 2015 S. Jérémy "Qwoak"
+ *
+ * Cirion is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cirion is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file    tilemap.cpp
+ * @version 0.1
+ * @author  Jérémy S. "Qwoak"
+ * @date    18 Octobre 2026
+ * @brief   Collisions des corps contre la grille de tuiles.
+ */
+
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include <tinyxml2.h>
+#include <Cirion/ciexception.hpp>
+#include <Cirion/cirion.hpp>
+#include <Cirion/log.hpp>
+#include <Cirion/tilemap.hpp>
+#include <Cirion/world.hpp>
+#include <Cirion/xmlerror.hpp>
+
+using namespace std;
+using namespace cirion;
+using namespace tinyxml2;
+
+//! Marge des comparaisons: un bord posé sur une tuile ne la chevauche pas.
+static const float gTileEpsilon = 0.001f;
+
+//! @brief Fonction de calcul de la cellule contenant une coordonnée.
+//! @param coordinate La coordonnée, en pixels.
+//! @param size La taille d'une tuile sur cet axe.
+//! @return L'indice de la cellule, négatif hors de la map.
+static int toCell( float coordinate, int size )
+{
+    return (int)floor( coordinate / size );
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définition des constructeurs / déstructeurs.                           !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe TileMap.
+cirion::TileMap::TileMap():
+    mWidth ( 0 ),
+    mHeight( 0 ),
+    mPitch ( 0 ),
+    mTiles ( NULL ),
+    mSolid ( NULL ),
+    mOneWay( NULL ),
+    mSlopes( NULL )
+{
+    memset( mFlags, 0x00, sizeof(mFlags) );
+}
+
+//! @brief Déstructeur pour la classe TileMap.
+cirion::TileMap::~TileMap()
+{
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes publiques.                                    !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de chargement des drapeaux des tuiles d'un tileset.
+//!
+//! Sans fichier de drapeaux, toutes les tuiles sauf la 0 sont pleines.
+//! Le fichier Tilesets/<tileset>.xml redéfinit des tuiles ou des plages:
+//!     <tileset>
+//!         <tiles from="1" to="255" type="solid"/>
+//!         <tile id="2" type="oneway"/>
+//!         <tile id="3" type="slope" left="0" right="16"/>
+//!     </tileset>
+//! Les drapeaux ne sont remplacés qu'en cas de succès.
+//! @param tileset Le nom du tileset.
+//! @throw CiException si le fichier est invalide.
+void cirion::TileMap::loadFlags( const char* tileset )
+{
+    CIRION_PROFILE_ZONE( "TileMap::loadFlags" );
+
+    ostringstream filepath;
+    XMLDocument   xml;
+    XMLElement*   tilesetNode;
+    XMLElement*   tileNode;
+    TileFlags     tileFlags[TILEMAP_TILES];
+
+    // Valeurs par défaut.
+    for( int i = 0; i != TILEMAP_TILES; i++ )
+    {
+        tileFlags[i].type  = i == 0 ? TILE_EMPTY : TILE_SOLID;
+        tileFlags[i].left  = 0;
+        tileFlags[i].right = 0;
+    }
+
+    filepath << gWorkingDir
+             << "/Tilesets/"
+             << tileset
+             << ".xml";
+
+    if( xml.LoadFile( filepath.str().c_str() ) != XML_NO_ERROR )
+    {
+        ostringstream oss;
+
+        oss << "No tile flags for tileset \""
+            << tileset
+            << "\" ("
+            << getXmlErrorStr( xml.ErrorID() )
+            << "): every tile but 0 is solid.";
+
+        log( oss.str().c_str(), __PRETTY_FUNCTION__ );
+        memcpy( mFlags, tileFlags, sizeof(mFlags) );
+        return;
+    }
+
+    tilesetNode = xml.FirstChildElement( (const char*)"tileset" );
+
+    if( tilesetNode == NULL )
+    {
+        throw CiException( "Unable to load tile flags: Expected <tileset> node.",
+            __PRETTY_FUNCTION__ );
+    }
+
+    // --- Parcours des noeuds <tile> et <tiles>. ------------------------------
+    for( tileNode = tilesetNode->FirstChildElement();
+         tileNode != NULL;
+         tileNode = tileNode->NextSiblingElement() )
+    {
+        TileFlags   flags;
+        const char* type = tileNode->Attribute( "type" );
+        int         from;
+        int         to;
+
+        if( strcmp( tileNode->Name(), "tile" ) == 0 )
+        {
+            from = tileNode->IntAttribute( "id" );
+            to   = from;
+        }
+
+        else if( strcmp( tileNode->Name(), "tiles" ) == 0 )
+        {
+            from = tileNode->IntAttribute( "from" );
+            to   = tileNode->IntAttribute( "to" );
+        }
+
+        else
+        {
+            continue;
+        }
+
+        flags.left  = (Uint8)tileNode->IntAttribute( "left" );
+        flags.right = (Uint8)tileNode->IntAttribute( "right" );
+
+        if( type == NULL || strcmp( type, "empty" ) == 0 )
+        {
+            flags.type = TILE_EMPTY;
+        }
+
+        else if( strcmp( type, "solid" ) == 0 )
+        {
+            flags.type = TILE_SOLID;
+        }
+
+        else if( strcmp( type, "oneway" ) == 0 )
+        {
+            flags.type = TILE_ONEWAY;
+        }
+
+        else if( strcmp( type, "slope" ) == 0 )
+        {
+            flags.type = TILE_SLOPE;
+        }
+
+        else
+        {
+            ostringstream oss;
+
+            oss << "Unable to load tile flags of \""
+                << tileset
+                << "\": unknown tile type \""
+                << type
+                << "\".";
+
+            throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+        }
+
+        if(    from < 0 || to >= TILEMAP_TILES || from > to
+            || flags.left > TILE_H || flags.right > TILE_H )
+        {
+            ostringstream oss;
+
+            oss << "Unable to load tile flags of \""
+                << tileset
+                << "\": tile "
+                << from
+                << " out of range.";
+
+            throw CiException( oss.str().c_str(), __PRETTY_FUNCTION__ );
+        }
+
+        for( int i = from; i <= to; i++ )
+        {
+            tileFlags[i] = flags;
+        }
+    }
+
+    memcpy( mFlags, tileFlags, sizeof(mFlags) );
+}
+
+//! @brief Procédure de définition des drapeaux d'une tuile.
+//! @param tile L'index de la tuile.
+//! @param flags Les drapeaux.
+void cirion::TileMap::setFlags( unsigned char tile, const TileFlags& flags )
+{
+    mFlags[tile] = flags;
+}
+
+//! @brief Procédure de construction des plans de bits depuis une map.
+//! @param cmf La map.
+//! @param arena L'arène du niveau, qui doit survivre à la grille.
+void cirion::TileMap::build( Cmf& cmf, Arena& arena )
+{
+    mWidth  = cmf.getWidth();
+    mHeight = cmf.getHeight();
+    mTiles  = arena.allocate<Uint8>( mWidth * mHeight );
+
+    for( int y = 0; y != mHeight; y++ )
+    {
+        for( int x = 0; x != mWidth; x++ )
+        {
+            mTiles[y * mWidth + x] = cmf.getTile( y, x );
+        }
+    }
+
+    buildPlanes( arena );
+}
+
+//! @brief Procédure de construction des plans de bits.
+//! @param width La largeur, en tuiles.
+//! @param height La hauteur, en tuiles.
+//! @param tiles L'index des tuiles, rangée par rangée; il est recopié.
+//! @param arena L'arène du niveau, qui doit survivre à la grille.
+void cirion::TileMap::build( int width, int height, const Uint8* tiles,
+                             Arena& arena )
+{
+    mWidth  = width;
+    mHeight = height;
+    mTiles  = arena.allocate<Uint8>( width * height );
+
+    memcpy( mTiles, tiles, width * height );
+    buildPlanes( arena );
+}
+
+//! @brief Fonction de déplacement d'une boîte contre la grille.
+//!
+//! Le déplacement est résolu axe par axe, horizontal d'abord. Sur chaque
+//! axe, seules les rangées ou colonnes franchies par le bord avant sont
+//! testées, dans l'ordre du déplacement: le premier obstacle arrête la
+//! boîte contre lui. Hors de la map, les côtés et le dessous sont pleins.
+//!
+//! Les pentes sont suivies par le centre du bas de la boîte; une boîte au
+//! sol reste accrochée à une pente descendante et peut monter d'une
+//! demi-tuile par déplacement.
+//! @param position La position de l'objet, mise à jour.
+//! @param hitbox La hitbox, relative à la position.
+//! @param delta Le déplacement voulu, en pixels.
+//! @param isGrounded Vrai si la boîte était au sol.
+//! @return Les contacts rencontrés (TileContact).
+Uint32 cirion::TileMap::move( Point2f& position, const SDL_Rect& hitbox,
+                              const Point2f& delta, bool isGrounded )
+{
+    Uint32 contacts = 0;
+    float  surface;
+
+    // --- Déplacement horizontal. ---------------------------------------------
+    if( delta.mX != 0.0f )
+    {
+        float top      = position.mY + hitbox.y;
+        float bottom   = top + hitbox.h;
+        float centerX  = position.mX + hitbox.x + hitbox.w / 2.0f;
+        int   firstRow = toCell( top, TILE_H );
+        int   lastRow  = toCell( bottom - gTileEpsilon, TILE_H );
+
+        // Centre sur une pente: la rangée du bas appartient à la pente.
+        if( findSlope( lastRow, centerX, &surface ) )
+        {
+            lastRow--;
+        }
+
+        if( delta.mX > 0.0f )
+        {
+            float edge = position.mX + hitbox.x + hitbox.w;
+            int   last = toCell( edge + delta.mX - gTileEpsilon, TILE_W );
+
+            position.mX += delta.mX;
+
+            for( int c = toCell( edge - gTileEpsilon, TILE_W ) + 1; c <= last; c++ )
+            {
+                if( isSolidColumn( c, firstRow, lastRow ) )
+                {
+                    position.mX = c * TILE_W - hitbox.x - hitbox.w;
+                    contacts   |= TILE_CONTACT_WALL;
+                    break;
+                }
+            }
+        }
+
+        else
+        {
+            float edge = position.mX + hitbox.x;
+            int   last = toCell( edge + delta.mX, TILE_W );
+
+            position.mX += delta.mX;
+
+            for( int c = toCell( edge, TILE_W ) - 1; c >= last; c-- )
+            {
+                if( isSolidColumn( c, firstRow, lastRow ) )
+                {
+                    position.mX = ( c + 1 ) * TILE_W - hitbox.x;
+                    contacts   |= TILE_CONTACT_WALL;
+                    break;
+                }
+            }
+        }
+    }
+
+    // --- Déplacement vertical. -----------------------------------------------
+    float left        = position.mX + hitbox.x;
+    float centerX     = left + hitbox.w / 2.0f;
+    int   firstColumn = toCell( left, TILE_W );
+    int   lastColumn  = toCell( left + hitbox.w - gTileEpsilon, TILE_W );
+
+    if( delta.mY < 0.0f )
+    {
+        float edge = position.mY + hitbox.y;
+        int   last = toCell( edge + delta.mY, TILE_H );
+
+        position.mY += delta.mY;
+
+        // Les plateformes et les pentes se traversent par le dessous.
+        for( int r = toCell( edge, TILE_H ) - 1; r >= last; r-- )
+        {
+            if( isSolidRow( r, firstColumn, lastColumn ) )
+            {
+                position.mY = ( r + 1 ) * TILE_H - hitbox.y;
+                contacts   |= TILE_CONTACT_CEILING;
+                break;
+            }
+        }
+
+        return contacts;
+    }
+
+    float start   = position.mY + hitbox.y + hitbox.h;
+    float bottom  = start + delta.mY;
+    float probe   = bottom + ( isGrounded ? TILE_H / 2 : 0 );
+    float slope   = FLT_MAX;
+    int   current = toCell( start - gTileEpsilon, TILE_H );
+
+    /* Sortie d'une pente sur un plateau: le bas de la boîte a pu s'enfoncer
+    dans la tuile pleine voisine; il est remonté. */
+    if(    start - current * TILE_H <= TILE_H / 2
+        && isSolidRow( current, firstColumn, lastColumn ) )
+    {
+        bottom    = current * TILE_H;
+        probe     = bottom;
+        contacts |= TILE_CONTACT_GROUND;
+    }
+
+    else
+    {
+        int last = toCell( bottom - gTileEpsilon, TILE_H );
+
+        for( int r = current + 1; r <= last; r++ )
+        {
+            if(    isSolidRow( r, firstColumn, lastColumn )
+                || (    start <= r * TILE_H + gTileEpsilon
+                     && isOneWayRow( r, firstColumn, lastColumn ) ) )
+            {
+                bottom    = r * TILE_H;
+                probe     = bottom;
+                contacts |= TILE_CONTACT_GROUND;
+                break;
+            }
+        }
+
+        /* Au repos sur le sol, sans déplacement vertical: la rangée sous la
+        boîte n'est pas traversée, mais la porte toujours. */
+        if(    !( contacts & TILE_CONTACT_GROUND )
+            && isGrounded
+            && bottom >= ( current + 1 ) * TILE_H - gTileEpsilon
+            && (    isSolidRow( current + 1, firstColumn, lastColumn )
+                 || isOneWayRow( current + 1, firstColumn, lastColumn ) ) )
+        {
+            bottom    = ( current + 1 ) * TILE_H;
+            probe     = bottom;
+            contacts |= TILE_CONTACT_GROUND;
+        }
+    }
+
+    // Pentes sous le centre, de la rangée au-dessus du départ à la sonde.
+    for( int r = current - 1; r <= toCell( probe - gTileEpsilon, TILE_H ); r++ )
+    {
+        if(    findSlope( r, centerX, &surface )
+            && surface >= start - TILE_H / 2
+            && surface <= probe
+            && surface <  slope )
+        {
+            slope = surface;
+        }
+    }
+
+    if( slope != FLT_MAX && ( slope < bottom || !( contacts & TILE_CONTACT_GROUND ) ) )
+    {
+        bottom    = slope;
+        contacts |= TILE_CONTACT_GROUND;
+    }
+
+    position.mY = bottom - hitbox.y - hitbox.h;
+
+    return contacts;
+}
+
+//! @brief Fonction accesseur.
+//! @return La largeur de la map, en tuiles.
+int cirion::TileMap::getWidth()
+{
+    return mWidth;
+}
+
+//! @brief Fonction accesseur.
+//! @return La hauteur de la map, en tuiles.
+int cirion::TileMap::getHeight()
+{
+    return mHeight;
+}
+
+/* +------------------------------------------------------------------------+
+   ! Définitions des méthodes privées.                                      !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Procédure de construction des plans de bits depuis l'index.
+//! @param arena L'arène du niveau.
+void cirion::TileMap::buildPlanes( Arena& arena )
+{
+    size_t words;
+
+    mPitch  = ( mWidth + 31 ) / 32;
+    words   = mPitch * mHeight;
+    mSolid  = arena.allocate<Uint32>( words );
+    mOneWay = arena.allocate<Uint32>( words );
+    mSlopes = arena.allocate<Uint32>( words );
+
+    memset( mSolid,  0x00, words * sizeof(Uint32) );
+    memset( mOneWay, 0x00, words * sizeof(Uint32) );
+    memset( mSlopes, 0x00, words * sizeof(Uint32) );
+
+    for( int y = 0; y != mHeight; y++ )
+    {
+        for( int x = 0; x != mWidth; x++ )
+        {
+            Uint32 bit  = 1u << ( x & 31 );
+            size_t word = y * mPitch + ( x >> 5 );
+
+            switch( mFlags[mTiles[y * mWidth + x]].type )
+            {
+                case TILE_SOLID:  mSolid[word]  |= bit; break;
+                case TILE_ONEWAY: mOneWay[word] |= bit; break;
+                case TILE_SLOPE:  mSlopes[word] |= bit; break;
+            }
+        }
+    }
+}
+
+//! @brief Fonction de test d'une suite de tuiles d'une rangée, mot par mot.
+//! @param plane Le plan de bits.
+//! @param row La rangée, dans la map.
+//! @param first La première colonne, dans la map.
+//! @param last La dernière colonne, dans la map.
+//! @return Vrai si un bit est levé.
+bool cirion::TileMap::testRow( const Uint32* plane, int row,
+                               int first, int last )
+{
+    const Uint32* words = &plane[row * mPitch];
+
+    for( int w = first >> 5; w <= last >> 5; w++ )
+    {
+        Uint32 mask = 0xFFFFFFFF;
+
+        if( w == first >> 5 )
+        {
+            mask &= 0xFFFFFFFF << ( first & 31 );
+        }
+
+        if( w == last >> 5 )
+        {
+            mask &= 0xFFFFFFFF >> ( 31 - ( last & 31 ) );
+        }
+
+        if( words[w] & mask )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//! @brief Fonction de test des tuiles pleines d'une rangée.
+//! @param row La rangée.
+//! @param first La première colonne.
+//! @param last La dernière colonne.
+//! @return Vrai si une tuile est pleine.
+bool cirion::TileMap::isSolidRow( int row, int first, int last )
+{
+    if( first < 0 || last >= mWidth || row >= mHeight )
+    {
+        return true;
+    }
+
+    return row >= 0 && testRow( mSolid, row, first, last );
+}
+
+//! @brief Fonction de test des plateformes à sens unique d'une rangée.
+//!
+//! Hors de la map, il n'y a pas de plateforme.
+//! @param row La rangée.
+//! @param first La première colonne.
+//! @param last La dernière colonne.
+//! @return Vrai si une plateforme occupe la rangée entre les colonnes.
+bool cirion::TileMap::isOneWayRow( int row, int first, int last )
+{
+    if( row < 0 || row >= mHeight )
+    {
+        return false;
+    }
+
+    return testRow( mOneWay, row,
+                    first < 0 ? 0 : first,
+                    last >= mWidth ? mWidth - 1 : last );
+}
+
+//! @brief Fonction de test des tuiles pleines d'une colonne.
+//! @param column La colonne.
+//! @param first La première rangée.
+//! @param last La dernière rangée.
+//! @return Vrai si une tuile est pleine.
+bool cirion::TileMap::isSolidColumn( int column, int first, int last )
+{
+    if( column < 0 || column >= mWidth )
+    {
+        return true;
+    }
+
+    for( int r = first; r <= last; r++ )
+    {
+        if( r >= mHeight )
+        {
+            return true;
+        }
+
+        if( r >= 0 && ( mSolid[r * mPitch + ( column >> 5 )]
+                        & ( 1u << ( column & 31 ) ) ) )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//! @brief Fonction de lecture du sol d'une pente.
+//! @param row La rangée.
+//! @param x L'abscisse du point suivi, en pixels.
+//! @param surface L'ordonnée du sol sous ce point, si la tuile est une pente.
+//! @return Vrai si la tuile est une pente.
+bool cirion::TileMap::findSlope( int row, float x, float* surface )
+{
+    int       column = toCell( x, TILE_W );
+    float     t;
+    TileFlags flags;
+
+    if(    row < 0 || row >= mHeight || column < 0 || column >= mWidth
+        || !( mSlopes[row * mPitch + ( column >> 5 )] & ( 1u << ( column & 31 ) ) ) )
+    {
+        return false;
+    }
+
+    flags    = mFlags[mTiles[row * mWidth + column]];
+    t        = ( x - column * TILE_W ) / TILE_W;
+    *surface = ( row + 1 ) * TILE_H - ( flags.left + ( flags.right - flags.left ) * t );
+
+    return true;
+}
@@ -79,3 +79,76 @@ Uint32 cirion::Timer::getTicks()
 {
     return mRunning ? SDL_GetTicks() - mStartTicks : mStopTicks;
 }
+
+/* +------------------------------------------------------------------------+
+   ! Définitions constructeurs / déstructeurs de HrTimer.                   !
+   +------------------------------------------------------------------------+ */
+
+//! @brief Constructeur pour la classe HrTimer.
+cirion::HrTimer::HrTimer()
+{
+    mRunning      = false;
+    mStartCounter = 0;
+    mStopCounter  = 0;
+}
+
+/*  +-----------------------------------------------------------------------+
+    ! Définition méthodes de HrTimer.                                       !
+    +-----------------------------------------------------------------------+ */
+
+//! @brief  Fonction accesseur.
+//! @return Vrai si le chronomètre est en marche.
+bool cirion::HrTimer::isRunning()
+{
+    return mRunning;
+}
+
+//! @brief Procédure de démarrage du chronomètre.
+void cirion::HrTimer::start()
+{
+    if( !mRunning )
+    {
+        mRunning      = true;
+        mStartCounter = SDL_GetPerformanceCounter() - mStopCounter;
+        mStopCounter  = 0;
+    }
+}
+
+//! @brief Procédure d'arrêt du chronomètre.
+void cirion::HrTimer::stop()
+{
+    if( mRunning )
+    {
+        mRunning      = false;
+        mStopCounter  = SDL_GetPerformanceCounter() - mStartCounter;
+        mStartCounter = 0;
+    }
+}
+
+//! @brief Procédure de remize à zéro du chronomètre.
+void cirion::HrTimer::reset()
+{
+    mStartCounter = SDL_GetPerformanceCounter();
+    mStopCounter  = 0;
+}
+
+//! @brief  Fonction accesseur.
+//! @return Le temps d'écoulement du chronomètre, en ns.
+Uint64 cirion::HrTimer::getNanoseconds()
+{
+    return toNanoseconds( mRunning
+                        ? SDL_GetPerformanceCounter() - mStartCounter
+                        : mStopCounter );
+}
+
+//! @brief  Fonction de conversion d'un nombre de battements en ns, sans
+//!         débordement.
+//! @param  counter Un nombre de battements du compteur haute résolution.
+//! @return La durée en ns.
+Uint64 cirion::HrTimer::toNanoseconds( Uint64 counter )
+{
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+
+    return counter / frequency * 1000000000
+         + counter % frequency * 1000000000 / frequency;
+}
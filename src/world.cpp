@@ -64,19 +64,33 @@ cirion::World::~World()
 //! @throw CiException en cas d'échec.
 void cirion::World::create( const char* name )
 {
+    CIRION_PROFILE_ZONE( "World::create" );
+
+    ostringstream oss;
+    Uint64        start  = SDL_GetPerformanceCounter();
+    unsigned int  hits   = gStats.pixelPoolHits;
+    unsigned int  misses = gStats.pixelPoolMisses;
+    Cmf           cmf;
+    Texture       tileset;
+    Texture       background;
+
+    /* Tout est chargé à part avant de toucher au niveau en cours: une map
+    ou un tileset invalide le laisse intact. */
     try
     {
         /* Chargement du fichier CMF. */
         #ifdef DEBUG
-            mCmf.load( name, false );
+            cmf.load( name, false );
         #else
-            mCmf.load( name );
+            cmf.load( name );
         #endif
 
         /* Création des ressources. */
-        mTileset.create( mCmf.getTilesetName() );
-        mBackground.create( mCmf.getBackgroundName() );
-        
+        tileset.create( cmf.getTilesetName() );
+        background.create( cmf.getBackgroundName() );
+
+        /* Drapeaux des tuiles, remplacés seulement en cas de succès. */
+        mTileMap.loadFlags( cmf.getTilesetName() );
     }
 
     catch( CiException const& e )
@@ -87,6 +101,16 @@ void cirion::World::create( const char* name )
             __PRETTY_FUNCTION__ );
     }
 
+    /* Construction de la grille de collision, dans l'arène rendue d'un coup
+    avec le niveau précédent. Les anciennes textures sont libérées en
+    quittant la procédure. */
+    mCmf = cmf;
+    mArena.reset();
+    mTileMap.build( mCmf, mArena );
+    mTileset.swap( tileset );
+    mBackground.swap( background );
+    mName = name;
+
     /* Init. des dimensions sources et d'affichage du background. */
     mBackgroundSrc.w  = mBackground.getWidth();
     mBackgroundSrc.h  = mBackground.getHeight();
@@ -98,22 +122,76 @@ void cirion::World::create( const char* name )
     mTileSrc.h  = gTileHeight;
     mTileDest.w = mTileSrc.w;
     mTileDest.h = mTileSrc.h;
+
+    oss << "World \""
+        << name
+        << "\" created in "
+        << ( SDL_GetPerformanceCounter() - start ) * 1000000
+         / SDL_GetPerformanceFrequency()
+        << " us (pixel pool: "
+        << gStats.pixelPoolHits - hits
+        << " hit(s), "
+        << gStats.pixelPoolMisses - misses
+        << " miss(es)).";
+
+    log( oss.str().c_str(), __PRETTY_FUNCTION__ );
 }
 
-//! @brief Procédure de gestion d'un évenement pour le monde.
-void cirion::World::handleEvent( SDL_Event* event )
+//! @brief Procédure de recherche des textures du monde portant un nom.
+//! @param name Le nom de la texture.
+//! @param textures Les textures trouvées, ajoutées à la suite.
+void cirion::World::findTextures( const char* name, vector<Texture*>& textures )
 {
-    /* Pacrours de la liste des objets */
-    for( size_t i = 0; i != mObjects.size(); i++ )
+    if( mName.size() == 0 )
+    {
+        return;
+    }
+
+    if( mTileset.getName() != NULL && string( mTileset.getName() ) == name )
+    {
+        textures.push_back( &mTileset );
+    }
+
+    if(    mBackground.getName() != NULL
+        && string( mBackground.getName() ) == name )
     {
-        /* Gestion de l'évenement pour l'objet. */
-        mObjects[i]->handleEvent( event );
+        textures.push_back( &mBackground );
     }
 }
 
+//! @brief Fonction accesseur.
+//! @return Le nom du fichier CMF du monde.
+const char* cirion::World::getName()
+{
+    return mName.c_str();
+}
+
+//! @brief Fonction accesseur.
+//! @return La grille de collision de la map.
+TileMap& cirion::World::getTileMap()
+{
+    return mTileMap;
+}
+
+//! @brief Fonction accesseur.
+//! @return La mémoire occupée par le tileset et le background, en octets.
+size_t cirion::World::getTextureMemorySize()
+{
+    return mTileset.getMemorySize() + mBackground.getMemorySize();
+}
+
+//! @brief Fonction accesseur.
+//! @return L'arène des données du niveau.
+Arena& cirion::World::getArena()
+{
+    return mArena;
+}
+
 //! @brief Procédure de mise à jour du monde.
-void cirion::World::update( int timeStep )
+void cirion::World::update( float timeStep )
 {
+    CIRION_PROFILE_ZONE( "World::update" );
+
     // --- Déplacement vertical. -----------------------------------------------
 
     /* Centrage si hauteur inférieure au renderer. */
@@ -131,21 +209,18 @@ void cirion::World::update( int timeStep )
         mPosition.mX = (int)( mCmf.getWidth() * gTileWidth - gRendererWidth  )
                      / 2;
     }
-
-    // --- Mise à jour des objets. ---------------------------------------------
-
-    /* Pacrours de la liste des objets */
-    for( size_t i = 0; i != mObjects.size(); i++ )
-    {
-        mObjects[i]->update();
-    }
 }
 
 //! @brief Procédure de dessin du background.
 void cirion::World::drawBackground()
 {
+    CIRION_PROFILE_ZONE( "World::drawBackground" );
+
+    // Marquée comme utilisée, comme les textures des objets.
+    SDL_Texture* background = mBackground.bind();
+
     // Attention: ignoblité visuelle
-    if( mBackground.getSdl2Texture() != NULL )
+    if( background != NULL )
     {
         for( mBackgroundDest.y 
                 = mPosition.mY > 0
@@ -164,10 +239,9 @@ void cirion::World::drawBackground()
                  mBackgroundDest.x += mBackgroundDest.w )
             {
                 /* Copie du background dans le renderer. */
-                SDL_RenderCopy( gRenderer,
-                                mBackground.getSdl2Texture(),
-                                &mBackgroundSrc,
-                                &mBackgroundDest );
+                renderCopy( background,
+                            &mBackgroundSrc,
+                            &mBackgroundDest );
             }
         }
     }
@@ -176,11 +250,14 @@ void cirion::World::drawBackground()
 // @brief Procédure de dessin de la map.
 void cirion::World::drawMap()
 {
+    CIRION_PROFILE_ZONE( "World::drawMap" );
+
     unsigned char tile;       //!< Valeur de la tuile parcourue depuis le cmf.
     size_t        tileStartX; //!< Abscisse de la tuile de démarrage dans cmf.
     size_t        tileStartY; //!< Ordonnée de la tuile de démarrage dans cmf.
     size_t        tileEndX;   //!< Abscisse de la tuile de fin dans le cmf.
     size_t        tileEndY;   //!< Ordonnée de la tuile de fin dans le cmf.
+    SDL_Texture*  tileset;    //!< Le tileset, marqué comme utilisé.
 
     /* --- Calcul des tuiles de départ et de fin pour l'affichage de la map. -*/
 
@@ -215,7 +292,9 @@ void cirion::World::drawMap()
     }
 
     /* --- Dessin de la map. ------------------------------------------------ */
-    if( mTileset.getSdl2Texture() != NULL )
+    tileset = mTileset.bind();
+
+    if( tileset != NULL )
     {
         for( size_t y  = tileStartY;
              y        != tileEndY;
@@ -237,30 +316,28 @@ void cirion::World::drawMap()
                 mTileDest.y = ( y * gTileHeight ) - mPosition.mY;
 
                 /* Copie de la tuile dans le renderer. */
-                SDL_RenderCopy( gRenderer,
-                                mTileset.getSdl2Texture(),
-                                &mTileSrc,
-                                &mTileDest );
+                renderCopy( tileset,
+                            &mTileSrc,
+                            &mTileDest );
             }
         }
     }
 }
 
-// @brief Procédure de dessin des objets.
-void cirion::World::drawObjects()
+// @brief Procédure de dessin des objets, dans le repère du monde.
+//! @param alpha Fraction de mise à jour écoulée depuis la dernière, [0, 1].
+void cirion::World::drawObjects( float alpha )
 {
-    /* Parcours de la liste des objets */
-    for( size_t i = 0; i != mObjects.size(); i++ )
-    {
-        /* Dessin de l'objet */
-        mObjects[i]->draw( mPosition );
-    }
+    CIRION_PROFILE_ZONE( "World::drawObjects" );
+
+    gRegistry.draw( mPosition, alpha );
 }
 
 //! @brief Procédure de dessin du monde.
-void cirion::World::draw()
+//! @param alpha Fraction de mise à jour écoulée depuis la dernière, [0, 1].
+void cirion::World::draw( float alpha )
 {
     drawBackground();
     drawMap();
-    drawObjects();
+    drawObjects( alpha );
 }